@@ -0,0 +1,997 @@
+// Standalone micro-benchmarks for the polynomial core.
+// Build: g++ -O2 -std=c++20 -I../src PolyBench.cpp ../src/*Solver.cpp ../src/RealRootIsolator.cpp ../src/TaskScheduler.cpp ../src/SquareFreeDecomposition.cpp ../src/BigInteger.cpp ../src/Rational.cpp -o polybench -lpthread
+// Run:   ./polybench [section...]   (no arguments runs every section)
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <new>
+#include <numbers>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Polynomial.h"
+#include "PolynomialFactory.h"
+#include "PolynomialSolver.h"
+#include "Rational.h"
+#include "SparsePolynomial.h"
+#include "SubproductTree.h"
+#include "AberthSolver.h"
+#include "ExpressionParser.h"
+#include "ClosedFormSolver.h"
+#include "EscalatingSolver.h"
+#include "RealRootIsolator.h"
+#include "SolverContext.h"
+#include "TaskScheduler.h"
+
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<long> g_allocations{0};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    std::size_t a = static_cast<std::size_t>(align);
+    if (void* p = std::aligned_alloc(a, (size + a - 1) / a * a)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+static volatile double g_sink = 0;
+
+template<typename F>
+static double secondsFor(F&& body, int repeats = 5) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = Clock::now();
+        body();
+        double s = std::chrono::duration<double>(Clock::now() - start).count();
+        if (s < best) best = s;
+    }
+    return best;
+}
+
+template<typename T>
+static std::vector<T> randomValues(size_t n, T lo, T hi, unsigned seed = 42) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dis(static_cast<double>(lo), static_cast<double>(hi));
+    std::vector<T> v(n);
+    for (auto& x : v) x = static_cast<T>(dis(gen));
+    return v;
+}
+
+template<typename T>
+static void benchEvaluateManyFor(const char* name) {
+    const size_t points = 1 << 14;
+    auto xs = randomValues<T>(points, T(-1), T(1));
+    std::vector<T> out(points);
+
+    std::printf("  %-12s %8s %14s %14s %8s\n", name, "degree", "loop pts/s", "batch pts/s", "speedup");
+    for (int degree : {3, 8, 32, 128}) {
+        Polynomial<T> p(randomValues<T>(degree + 1, T(-5), T(5), degree));
+
+        double loop = secondsFor([&] {
+            for (size_t i = 0; i < points; ++i) out[i] = p.evaluate(xs[i]);
+            g_sink = g_sink + static_cast<double>(out[points / 2]);
+        });
+        double batch = secondsFor([&] {
+            p.evaluateMany(xs, out);
+            g_sink = g_sink + static_cast<double>(out[points / 2]);
+        });
+        std::printf("  %-12s %8d %14.3e %14.3e %7.2fx\n", "", degree,
+                    points / loop, points / batch, loop / batch);
+    }
+}
+
+static void benchEvaluateMany() {
+    static const char* levels[] = { "scalar", "avx2", "avx512" };
+    std::printf("evaluateMany vs evaluate loop (dispatch: %s)\n",
+                levels[static_cast<int>(detectSimdLevel())]);
+    benchEvaluateManyFor<float>("float");
+    benchEvaluateManyFor<double>("double");
+    benchEvaluateManyFor<long double>("long double");
+}
+
+static void benchNewtonStep() {
+    std::printf("Newton step cost: central difference vs evaluateDerivatives (fused Horner, Estrin from degree %d)\n",
+                Polynomial<double>::kEstrinDegree);
+    std::printf("  (fused: p and p' as central difference gives; with p'': what Halley's step asks for)\n");
+    std::printf("  %8s %16s %16s %8s %16s\n", "degree", "fd steps/s", "fused steps/s", "speedup", "with p'' steps/s");
+    const int steps = 1 << 16;
+    for (int degree : {3, 10, 50, 200}) {
+        Polynomial<double> p(randomValues<double>(degree + 1, -5.0, 5.0, degree));
+
+        double fd = secondsFor([&] {
+            double acc = 0;
+            for (int i = 0; i < steps; ++i) {
+                double x = 0.25 + i * 1e-7;
+                const double h = 1e-6;
+                double fx = p.evaluate(x);
+                double dfx = (p.evaluate(x + h) - p.evaluate(x - h)) / (2 * h);
+                acc += fx / dfx;
+            }
+            g_sink = acc;
+        });
+        double fused = secondsFor([&] {
+            double acc = 0;
+            for (int i = 0; i < steps; ++i) {
+                double x = 0.25 + i * 1e-7;
+                auto d = p.evaluateDerivatives(x);
+                acc += d.value / d.first;
+            }
+            g_sink = acc;
+        });
+        double withSecond = secondsFor([&] {
+            double acc = 0;
+            for (int i = 0; i < steps; ++i) {
+                double x = 0.25 + i * 1e-7;
+                auto d = p.evaluateDerivatives(x, true);
+                acc += d.value / d.first + d.second;
+            }
+            g_sink = acc;
+        });
+        std::printf("  %8d %16.3e %16.3e %7.2fx %16.3e\n", degree, steps / fd, steps / fused, fd / fused,
+                    steps / withSecond);
+    }
+}
+
+// Mirrors the pre-SmallVector deflation: vector copy, reversed copy, quotient, re-reversed quotient.
+static void legacyDeflateChain(std::vector<double> asc, const std::vector<double>& roots) {
+    for (double root : roots) {
+        int n = asc.size() - 1;
+        if (n <= 0) break;
+        std::vector<double> desc(n + 1);
+        for (int i = 0; i <= n; ++i) desc[n - i] = asc[i];
+        std::vector<double> qdesc(n);
+        double b = desc[0];
+        qdesc[0] = b;
+        for (int i = 1; i <= n - 1; ++i) {
+            b = desc[i] + root * b;
+            qdesc[i] = b;
+        }
+        std::vector<double> qasc(n);
+        for (int i = 0; i < n; ++i) qasc[n - 1 - i] = qdesc[i];
+        asc = std::vector<double>(qasc);
+    }
+}
+
+static void benchSolveAllocations() {
+    std::printf("Heap allocations per solveNewton call\n");
+    std::printf("  %8s %16s %16s %16s %12s\n", "degree", "vector deflation", "solveNewton",
+                "warm context", "reproducible");
+    SolverContext<double> context(7);
+    for (int degree : {2, 3, 6, 12, 24}) {
+        Polynomial<double> p(randomValues<double>(degree + 1, -5.0, 5.0, degree));
+        auto roots = PolynomialSolver<double>::solveNewton(p);
+        std::vector<double> coeffs(p.coeffs().begin(), p.coeffs().end());
+
+        long before = g_allocations.load();
+        legacyDeflateChain(coeffs, roots);
+        long legacy = g_allocations.load() - before;
+
+        before = g_allocations.load();
+        roots = PolynomialSolver<double>::solveNewton(p);
+        long current = g_allocations.load() - before;
+
+        PolynomialSolver<double>::solveNewton(p, context);
+        before = g_allocations.load();
+        auto warm = PolynomialSolver<double>::solveNewton(p, context);
+        long inContext = g_allocations.load() - before;
+
+        // A second context with the same seed must retrace the same guesses.
+        SolverContext<double> twin(7);
+        auto again = PolynomialSolver<double>::solveNewton(p, twin);
+        bool same = std::equal(warm.begin(), warm.end(), again.begin(), again.end());
+
+        std::printf("  %8d %16ld %16ld %16ld %12s\n", degree, legacy, current, inContext, same ? "yes" : "no");
+    }
+}
+
+static std::vector<double> legacyParse(const std::string& str) {
+    std::vector<double> coeffs;
+    std::stringstream ss(str);
+    std::string token;
+    while (std::getline(ss, token, ',')) {
+        if (!token.empty()) coeffs.push_back(std::stod(token));
+    }
+    return coeffs;
+}
+
+static void benchParse() {
+    std::printf("Coefficient parsing: stringstream/stod vs from_chars\n");
+    std::vector<std::string> catalog;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> degree(2, 6);
+    for (int i = 0; i < 20000; ++i) {
+        auto coeffs = randomValues<double>(degree(gen) + 1, -5.0, 5.0, i);
+        std::ostringstream oss;
+        for (size_t k = 0; k < coeffs.size(); ++k) oss << (k ? "," : "") << coeffs[k];
+        catalog.push_back(oss.str());
+    }
+    std::vector<std::string_view> views(catalog.begin(), catalog.end());
+
+    double legacy = secondsFor([&] {
+        double acc = 0;
+        for (const auto& s : catalog) acc += legacyParse(s)[0];
+        g_sink = acc;
+    });
+    double single = secondsFor([&] {
+        double acc = 0;
+        for (auto s : views) acc += Polynomial<double>::parse(s).coeffs()[0];
+        g_sink = acc;
+    });
+    double bulk = secondsFor([&] {
+        auto buffer = CoefficientParser<double>::parseMany(views);
+        g_sink = buffer.values[0];
+    });
+    std::printf("  %-22s %12.3e polys/s\n", "stringstream + stod", catalog.size() / legacy);
+    std::printf("  %-22s %12.3e polys/s\n", "Polynomial::parse", catalog.size() / single);
+    std::printf("  %-22s %12.3e polys/s\n", "parseMany (bulk)", catalog.size() / bulk);
+}
+
+// max_i |p(z_i)| / sum_k |a_k| |z_i|^k, scaled so high degree does not overflow.
+// NaN when there are no roots to measure or any of them is not finite, which
+// std::max would otherwise skip and leave a perfect-looking 0.
+template<typename Roots>
+static double worstBackwardError(const Polynomial<double>& p, const Roots& roots) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    if (roots.begin() == roots.end()) return nan;
+    auto a = p.coeffs();
+    int n = p.degree();
+    double worst = 0;
+    for (std::complex<double> z : roots) {
+        if (!std::isfinite(z.real()) || !std::isfinite(z.imag())) return nan;
+        bool outside = std::abs(z) > 1;
+        std::complex<double> x = outside ? 1.0 / z : z;
+        std::complex<double> v = 0;
+        double bound = 0;
+        for (int i = 0; i <= n; ++i) {
+            int k = outside ? i : n - i;
+            v = v * x + a[k];
+            bound = bound * std::abs(x) + std::abs(a[k]);
+        }
+        worst = std::max(worst, std::abs(v) / bound);
+    }
+    return worst;
+}
+
+static void benchAberth() {
+    std::printf("All-roots solve: Newton + deflation vs Aberth-Ehrlich (random coefficients)\n");
+    std::printf("  %8s %12s %8s %14s %12s %8s %14s\n", "degree", "newton s", "finite", "newton err",
+                "aberth s", "finite", "aberth err");
+    for (int degree : {20, 100, 400, 1000}) {
+        Polynomial<double> p(randomValues<double>(degree + 1, -5.0, 5.0, degree));
+        std::vector<double> newtonRoots;
+        std::vector<std::complex<double>> aberthRoots;
+        double newton = secondsFor([&] { newtonRoots = PolynomialSolver<double>::solveNewton(p); }, 1);
+        double aberth = secondsFor([&] { aberthRoots = PolynomialSolver<double>::solveAberth(p); }, 1);
+        auto finite = [](const auto& roots) {
+            return std::count_if(roots.begin(), roots.end(),
+                                 [](std::complex<double> z) { return std::isfinite(std::abs(z)); });
+        };
+        std::printf("  %8d %12.4f %8td %14.3e %12.4f %8td %14.3e\n", degree,
+                    newton, finite(newtonRoots), worstBackwardError(p, newtonRoots),
+                    aberth, finite(aberthRoots), worstBackwardError(p, aberthRoots));
+    }
+}
+
+static void benchAberthScaling() {
+    std::printf("Parallel Aberth sweeps: wall time (s) by thread count\n");
+    const unsigned threadCounts[] = { 1, 2, 4, 8, 16 };
+    std::printf("  %8s", "degree");
+    for (unsigned t : threadCounts) std::printf(" %10u", t);
+    std::printf("\n");
+    for (int degree : {1000, 2000, 5000, 10000, 20000}) {
+        Polynomial<double> p(randomValues<double>(degree + 1, -5.0, 5.0, degree));
+        std::printf("  %8d", degree);
+        for (unsigned t : threadCounts) {
+            double s = secondsFor([&] {
+                auto roots = AberthSolver<double>::solveParallel(p, t);
+                g_sink = roots[0].real();
+            }, 1);
+            std::printf(" %10.3f", s);
+            std::fflush(stdout);
+        }
+        std::printf("\n");
+    }
+}
+
+static void benchEngines() {
+    std::printf("Medium degree engines: wall time (s) and worst backward error\n");
+    std::printf("  %8s %11s %11s %11s %11s %11s %11s\n", "degree",
+                "newton s", "newton err", "companion s", "comp err", "aberth s", "aberth err");
+    const SolverEngine engines[] = { SolverEngine::Newton, SolverEngine::Companion, SolverEngine::Aberth };
+    for (int degree : {20, 50, 100, 200}) {
+        Polynomial<double> p(randomValues<double>(degree + 1, -5.0, 5.0, degree + 1));
+        std::printf("  %8d", degree);
+        for (SolverEngine engine : engines) {
+            std::vector<std::complex<double>> roots;
+            double s = secondsFor([&] { roots = PolynomialSolver<double>::solve(p, engine); }, 3);
+            std::printf(" %11.5f %11.3e", s, worstBackwardError(p, roots));
+        }
+        std::printf("\n");
+    }
+}
+
+static void benchClosedForm() {
+    std::printf("Low degree: closed form vs iterative engines (10000 random polynomials per degree)\n");
+    std::printf("  %8s %11s %11s %11s %11s %11s %11s\n", "degree",
+                "closed ns", "closed err", "newton ns", "newton err", "aberth ns", "aberth err");
+    for (int degree : {2, 3, 4}) {
+        std::vector<Polynomial<double>> polys;
+        for (int i = 0; i < 10000; ++i) {
+            polys.emplace_back(randomValues<double>(degree + 1, -5.0, 5.0, 100000 * degree + i));
+        }
+        std::printf("  %8d", degree);
+
+        double err = 0;
+        double closed = secondsFor([&] {
+            for (const auto& p : polys) {
+                auto roots = ClosedFormSolver<double>::solve(p.coeffs());
+                g_sink = roots.roots[0].real();
+            }
+        });
+        for (const auto& p : polys) err = std::max(err, worstBackwardError(p, ClosedFormSolver<double>::solve(p.coeffs())));
+        std::printf(" %11.1f %11.3e", closed * 1e9 / polys.size(), err);
+
+        // Newton only looks for real roots, so its error is over what it reports.
+        err = 0;
+        double newton = secondsFor([&] {
+            for (const auto& p : polys) g_sink = PolynomialSolver<double>::solveNewton(p)[0];
+        }, 1);
+        for (const auto& p : polys) err = std::max(err, worstBackwardError(p, PolynomialSolver<double>::solveNewton(p)));
+        std::printf(" %11.1f %11.3e", newton * 1e9 / polys.size(), err);
+
+        err = 0;
+        double aberth = secondsFor([&] {
+            for (const auto& p : polys) g_sink = PolynomialSolver<double>::solveAberth(p)[0].real();
+        }, 1);
+        for (const auto& p : polys) err = std::max(err, worstBackwardError(p, PolynomialSolver<double>::solveAberth(p)));
+        std::printf(" %11.1f %11.3e\n", aberth * 1e9 / polys.size(), err);
+    }
+}
+
+static void benchBatch() {
+    std::printf("Batch solveNewton: polynomials/s, serial loop vs solveBatch (20000 random polynomials)\n");
+    std::vector<Polynomial<double>> polys;
+    for (int i = 0; i < 20000; ++i) {
+        int degree = 3 + i % 10;
+        polys.emplace_back(randomValues<double>(degree + 1, -5.0, 5.0, 7 * i + 1));
+    }
+
+    std::vector<std::vector<double>> serialRoots;
+    double serial = secondsFor([&] {
+        serialRoots.clear();
+        for (const auto& p : polys) serialRoots.push_back(PolynomialSolver<double>::solveNewton(p));
+    }, 1);
+    std::printf("  %-16s %12.3e polys/s\n", "serial loop", polys.size() / serial);
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u}) {
+        BatchOptions<double> options;
+        options.threads = threads;
+        BatchRoots<double> batch;
+        double s = secondsFor([&] { batch = PolynomialSolver<double>::solveBatch(polys, options); }, 1);
+
+        bool same = batch.size() == serialRoots.size();
+        for (size_t i = 0; same && i < batch.size(); ++i) {
+            same = std::equal(batch[i].begin(), batch[i].end(), serialRoots[i].begin(), serialRoots[i].end());
+        }
+        std::printf("  batch %2u threads %12.3e polys/s %7.2fx  %s\n", threads, polys.size() / s,
+                    serial / s, same ? "matches serial" : "DIFFERS");
+    }
+}
+
+// Recursive split down to ranges of `grain` evaluations; nested groups make
+// workers steal each other's halves.
+static double forkSum(TaskScheduler& scheduler, const Polynomial<double>& p, int lo, int hi, int grain) {
+    if (hi - lo <= grain) {
+        double acc = 0;
+        for (int i = lo; i < hi; ++i) acc += p.evaluateDerivatives(i * 1e-6).value;
+        return acc;
+    }
+    int mid = lo + (hi - lo) / 2;
+    double left = 0;
+    TaskGroup group(scheduler);
+    group.run([&] { left = forkSum(scheduler, p, lo, mid, grain); });
+    double right = forkSum(scheduler, p, mid, hi, grain);
+    group.wait();
+    return left + right;
+}
+
+static void benchScheduler() {
+    std::printf("Work-stealing scheduler: fork-join evaluation (1<<20 points, degree 16)\n");
+    std::printf("  %8s %8s %14s %10s %12s %10s %10s\n", "workers", "grain", "tasks/s", "steals", "idle ms", "max depth", "speedup");
+    Polynomial<double> p(randomValues<double>(17, -1.0, 1.0, 3));
+    const int points = 1 << 20;
+    double serial = secondsFor([&] {
+        double acc = 0;
+        for (int i = 0; i < points; ++i) acc += p.evaluateDerivatives(i * 1e-6).value;
+        g_sink = acc;
+    }, 3);
+    for (unsigned workers : {1u, 2u, 4u, 8u}) {
+        TaskScheduler scheduler(workers);
+        for (int grain : {256, 4096}) {
+            scheduler.resetCounters();
+            double s = secondsFor([&] { g_sink = forkSum(scheduler, p, 0, points, grain); }, 3);
+            auto c = scheduler.counters();
+            std::printf("  %8u %8d %14.3e %10llu %12.2f %10zu %9.2fx\n", workers, grain, c.executed / (3 * s),
+                        static_cast<unsigned long long>(c.steals), c.idle.count() / 1e6, c.maxQueueDepth, serial / s);
+        }
+    }
+
+    std::printf("  solveBatch, 20000 polynomials: own threads vs shared scheduler\n");
+    std::vector<Polynomial<double>> polys;
+    for (int i = 0; i < 20000; ++i) polys.emplace_back(randomValues<double>(4 + i % 10, -5.0, 5.0, 11 * i + 5));
+    BatchOptions<double> options;
+    double threads = secondsFor([&] { g_sink = PolynomialSolver<double>::solveBatch(polys, options).roots.size(); }, 1);
+    options.scheduler = &TaskScheduler::shared();
+    double tasks = secondsFor([&] { g_sink = PolynomialSolver<double>::solveBatch(polys, options).roots.size(); }, 1);
+    std::printf("  %-16s %12.3e polys/s\n  %-16s %12.3e polys/s\n", "own threads", polys.size() / threads,
+                "scheduler", polys.size() / tasks);
+}
+
+static void benchStreaming() {
+    std::printf("Streaming solve: time to first root vs total (Aberth, random coefficients)\n");
+    std::printf("  %8s %14s %14s %14s %14s\n", "degree", "first root ms", "half ms", "total ms", "worst resid");
+    for (int degree : {200, 1000, 3000}) {
+        Polynomial<double> p(randomValues<double>(degree + 1, -5.0, 5.0, degree + 7));
+        auto start = Clock::now();
+        double first = 0, half = 0, worst = 0;
+        size_t seen = 0;
+        RootSink<double> sink = [&](const std::complex<double>&, double residual) {
+            double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            if (seen == 0) first = ms;
+            if (++seen == static_cast<size_t>(degree) / 2) half = ms;
+            worst = std::max(worst, residual);
+        };
+        auto result = PolynomialSolver<double>::solve(p, SolveBudget{}, SolverEngine::Aberth,
+                                                      std::numeric_limits<double>::epsilon() * 4, 500, sink);
+        double total = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        g_sink = static_cast<double>(result.converged);
+        std::printf("  %8d %14.2f %14.2f %14.2f %14.3e\n", degree, first, half, total, worst);
+    }
+}
+
+static Polynomial<double> fromRoots(const std::vector<double>& roots) {
+    return PolynomialFactory<double>::fromRoots(roots);
+}
+
+static void benchMultiplicity() {
+    std::printf("Repeated roots: iterations and worst root error, plain vs square-free factors first\n");
+    std::printf("  %-26s %10s %10s %10s %10s %11s %11s\n", "roots", "newton", "newton sf", "aberth", "aberth sf",
+                "err", "err sf");
+    struct Case {
+        const char* name;
+        std::vector<double> roots;
+    };
+    std::vector<Case> cases = {
+        { "-1 x2", { -1, -1 } },
+        { "1 x4, 3", { 1, 1, 1, 1, 3 } },
+        { "-1 x2, 2 x3, 0.5", { -1, -1, 2, 2, 2, 0.5 } },
+        { "0.7 x6", { 0.7, 0.7, 0.7, 0.7, 0.7, 0.7 } },
+        { "1..4 each x2", { 1, 1, 2, 2, 3, 3, 4, 4 } },
+    };
+    const double tolerance = std::numeric_limits<double>::epsilon() * 4;
+    for (const auto& c : cases) {
+        auto p = fromRoots(c.roots);
+        // Distance from each reported root to the nearest true one.
+        auto worstError = [&](const SolveResult<double>& result) {
+            double worst = 0;
+            for (const auto& z : result.roots) {
+                double best = std::numeric_limits<double>::infinity();
+                for (double r : c.roots) best = std::min(best, std::abs(z - r));
+                worst = std::max(worst, best);
+            }
+            return worst;
+        };
+
+        SolverContext<double> context;
+        auto newton = PolynomialSolver<double>::solveNewton(p, context, SolveBudget{}, 1e-12, 1000);
+        auto newtonSf = PolynomialSolver<double>::solveWithMultiplicity(p, SolveBudget{}, SolverEngine::Newton, 1e-12, 1000);
+        auto aberth = PolynomialSolver<double>::solve(p, SolveBudget{}, SolverEngine::Aberth, tolerance, 500);
+        auto aberthSf = PolynomialSolver<double>::solveWithMultiplicity(p, SolveBudget{}, SolverEngine::Aberth, tolerance, 500);
+        std::printf("  %-26s %10d %10d %10d %10d %11.2e %11.2e\n", c.name, newton.iterations, newtonSf.iterations,
+                    aberth.iterations, aberthSf.iterations, worstError(aberth), worstError(aberthSf));
+    }
+}
+
+static void benchEscalation() {
+    std::printf("Precision escalation: Newton in double, escalating, and all double-double\n");
+    std::printf("  %-14s %11s %11s %11s %10s %12s %12s\n", "input", "double us", "escal. us", "all-dd us",
+                "escalated", "worst est", "worst est e");
+    struct Case {
+        std::string name;
+        std::vector<Polynomial<double>> polys;
+    };
+    std::vector<Case> cases;
+    Case random{ "random deg 10", {} };
+    for (int i = 0; i < 200; ++i) random.polys.emplace_back(randomValues<double>(11, -5.0, 5.0, 900 + i));
+    cases.push_back(std::move(random));
+    for (int n : { 12, 16, 20 }) {
+        std::vector<double> roots;
+        for (int k = 1; k <= n; ++k) roots.push_back(k);
+        cases.push_back({ "wilkinson " + std::to_string(n), { fromRoots(roots) } });
+    }
+    cases.push_back({ "cluster 1.00x", { fromRoots({ 1, 1.001, 1.002, 1.003, -2, 3 }) } });
+
+    // Newton's misses near complex pairs are not roots at any precision; the
+    // error columns only look at points with a small backward error.
+    auto isRoot = [](const Polynomial<double>& p, double x) {
+        return relativeResidual<double>(p.coeffs(), std::complex<double>(x)) <= 1e-8;
+    };
+    for (const auto& c : cases) {
+        std::vector<Polynomial<DoubleDouble>> wide;
+        for (const auto& p : c.polys) {
+            wide.emplace_back(std::vector<DoubleDouble>(p.coeffs().begin(), p.coeffs().end()));
+        }
+        double worstPlain = 0;
+        double worstEscalated = 0;
+        std::size_t escalated = 0;
+        std::size_t roots = 0;
+        double plain = secondsFor([&] {
+            worstPlain = 0;
+            for (const auto& p : c.polys) {
+                for (double r : PolynomialSolver<double>::solveNewton(p, 1e-10, 1000)) {
+                    if (isRoot(p, r)) {
+                        worstPlain = std::max(worstPlain, EscalatingSolver<double>::errorEstimate<double>(p.coeffs(), r)
+                                                              / std::max(1.0, std::abs(r)));
+                    }
+                }
+            }
+        });
+        double escalating = secondsFor([&] {
+            worstEscalated = 0;
+            escalated = roots = 0;
+            for (const auto& p : c.polys) {
+                auto result = EscalatingSolver<double>::solveNewton(p);
+                escalated += result.escalated;
+                roots += result.roots.size();
+                for (size_t i = 0; i < result.roots.size(); ++i) {
+                    if (isRoot(p, result.roots[i])) {
+                        worstEscalated = std::max(worstEscalated,
+                                                  result.errorEstimates[i] / std::max(1.0, std::abs(result.roots[i])));
+                    }
+                }
+            }
+        });
+        double allWide = secondsFor([&] {
+            for (const auto& p : wide) g_sink = PolynomialSolver<DoubleDouble>::solveNewton(p, 1e-20, 1000).size();
+        });
+        double per = 1e6 / c.polys.size();
+        std::printf("  %-14s %11.2f %11.2f %11.2f %4zu / %-3zu %12.2e %12.2e\n", c.name.c_str(), plain * per, escalating * per,
+                    allWide * per, escalated, roots, worstPlain, worstEscalated);
+    }
+}
+
+static void benchCompensated() {
+    std::printf("Compensated Horner: accuracy near the roots of (x-0.75)^5 (x-1)^11, cost on random degree 128\n");
+    std::vector<double> roots(5, 0.75);
+    roots.insert(roots.end(), 11, 1.0);
+    auto p = fromRoots(roots);
+    std::vector<DoubleDouble> wideCoeffs(p.coeffs().begin(), p.coeffs().end());
+    Polynomial<DoubleDouble> wide(wideCoeffs);
+    Polynomial<long double> longDouble(std::vector<long double>(p.coeffs().begin(), p.coeffs().end()));
+
+    const size_t points = 1 << 12;
+    std::vector<double> xs(points);
+    for (size_t i = 0; i < points; ++i) xs[i] = 0.68 + 0.47 * static_cast<double>(i) / points;
+    std::vector<double> out(points);
+
+    // Relative error against double-double Horner, capped at 1 (no correct digits).
+    auto errors = [&](const std::vector<double>& values) {
+        std::vector<double> err(points);
+        for (size_t i = 0; i < points; ++i) {
+            double exact = static_cast<double>(wide.evaluate(DoubleDouble(xs[i])));
+            err[i] = exact == 0 ? 0 : std::min(1.0, std::abs(values[i] - exact) / std::abs(exact));
+        }
+        std::sort(err.begin(), err.end());
+        return std::pair<double, double>(err[points / 2], err.back());
+    };
+
+    Polynomial<double> costPoly(randomValues<double>(129, -5.0, 5.0, 128));
+    auto costXs = randomValues<double>(points, -1.0, 1.0);
+    auto nsPerPoint = [&](auto&& body) { return secondsFor(body) * 1e9 / points; };
+
+    std::printf("  %-22s %12s %12s %12s\n", "mode", "median err", "max err", "ns/point");
+    auto report = [&](const char* name, auto&& evaluateAll, auto&& costAll) {
+        evaluateAll();
+        auto [median, worst] = errors(out);
+        std::printf("  %-22s %12.2e %12.2e %12.2f\n", name, median, worst, nsPerPoint(costAll));
+    };
+    report("plain, evaluateMany",
+           [&] { p.evaluateMany(xs, out); },
+           [&] { costPoly.evaluateMany(costXs, out); g_sink = out[1]; });
+    report("plain, per call",
+           [&] { for (size_t i = 0; i < points; ++i) out[i] = p.evaluate(xs[i]); },
+           [&] {
+               for (size_t i = 0; i < points; ++i) out[i] = costPoly.evaluate(costXs[i]);
+               g_sink = out[1];
+           });
+    report("compensated, batch",
+           [&] { p.evaluateMany(xs, out, EvaluationMode::Compensated); },
+           [&] { costPoly.evaluateMany(costXs, out, EvaluationMode::Compensated); g_sink = out[1]; });
+    report("compensated, per call",
+           [&] { for (size_t i = 0; i < points; ++i) out[i] = p.evaluate(xs[i], EvaluationMode::Compensated); },
+           [&] {
+               for (size_t i = 0; i < points; ++i) out[i] = costPoly.evaluate(costXs[i], EvaluationMode::Compensated);
+               g_sink = out[1];
+           });
+    std::vector<long double> costLong(costPoly.coeffs().begin(), costPoly.coeffs().end());
+    Polynomial<long double> costLongPoly(costLong);
+    report("long double recheck",
+           [&] { for (size_t i = 0; i < points; ++i) out[i] = static_cast<double>(longDouble.evaluate(xs[i])); },
+           [&] {
+               for (size_t i = 0; i < points; ++i) out[i] = static_cast<double>(costLongPoly.evaluate(costXs[i]));
+               g_sink = out[1];
+           });
+}
+
+// evaluate() before Estrin: a running power of x, one term at a time.
+static double powerSum(std::span<const double> coeffs, double x) {
+    double result = 0;
+    double power = 1;
+    for (double c : coeffs) {
+        result += c * power;
+        power *= x;
+    }
+    return result;
+}
+
+static void benchEstrin() {
+    std::printf("Single-point evaluation: power sum, Horner, Estrin (evaluate() switches at degree %d)\n",
+                Polynomial<double>::kEstrinDegree);
+    std::printf("  %8s %12s %12s %12s %12s %10s\n", "degree", "power ns", "horner ns", "estrin ns", "evaluate ns",
+                "max diff");
+    const size_t points = 1 << 12;
+    // Near |x| = 1 so that x^4096 neither overflows nor goes subnormal.
+    auto xs = randomValues<double>(points, 0.99, 1.01);
+    for (int degree : { 4, 8, 12, 16, 24, 32, 64, 128, 256, 512, 1024, 2048, 4096 }) {
+        Polynomial<double> p(randomValues<double>(degree + 1, -1.0, 1.0, degree));
+        const double* c = p.coeffs().data();
+        const size_t size = p.coeffs().size();
+        const int repeats = std::max(1, 2000 / degree);
+        auto nsFor = [&](auto&& evaluateOne) {
+            return secondsFor([&] {
+                double sum = 0;
+                for (int r = 0; r < repeats; ++r) {
+                    for (double x : xs) sum += evaluateOne(x);
+                }
+                g_sink = sum;
+            }) * 1e9 / (points * repeats);
+        };
+        double power = nsFor([&](double x) { return powerSum(p.coeffs(), x); });
+        double horner = nsFor([&](double x) {
+            double y;
+            hornerScalar(c, size, &x, &y, 1);
+            return y;
+        });
+        double est = nsFor([&](double x) { return estrin(c, size, x); });
+        double automatic = nsFor([&](double x) { return p.evaluate(x); });
+        double diff = 0;
+        for (double x : xs) {
+            double y;
+            hornerScalar(c, size, &x, &y, 1);
+            diff = std::max(diff, std::abs(estrin(c, size, x) - y) / std::max(1.0, std::abs(y)));
+        }
+        std::printf("  %8d %12.1f %12.1f %12.1f %12.1f %10.1e\n", degree, power, horner, est, automatic, diff);
+    }
+}
+
+static void benchMultiply() {
+    std::printf("Polynomial product, equal lengths, integer coefficients"
+                " (Auto: Karatsuba from %zu, FFT or, for exact integers, NTT from %zu)\n",
+                PolynomialMultiplier<double>::kKaratsubaThreshold, PolynomialMultiplier<double>::kFftThreshold);
+    std::printf("  %8s %12s %12s %12s %12s %12s %10s\n", "length", "school us", "karatsuba us", "fft us", "ntt us",
+                "auto us", "fft err");
+    for (size_t n : { 8, 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 1024, 2048, 4096, 8192 }) {
+        // Small integers, so NTT applies and the FFT's rounding is visible.
+        std::vector<double> a(n), b(n);
+        std::mt19937 gen(static_cast<unsigned>(n));
+        std::uniform_int_distribution<int> coeff(-50, 50);
+        for (auto& v : a) v = coeff(gen);
+        for (auto& v : b) v = coeff(gen);
+        Polynomial<double> pa(a), pb(b);
+
+        const int repeats = static_cast<int>(std::max<size_t>(1, 20000 / n));
+        auto usFor = [&](MultiplyAlgorithm algorithm) {
+            if (algorithm == MultiplyAlgorithm::Schoolbook && n > 4096) return std::numeric_limits<double>::quiet_NaN();
+            return secondsFor([&] {
+                for (int r = 0; r < repeats; ++r) {
+                    g_sink = Polynomial<double>::multiply(pa, pb, algorithm).coeffs()[n];
+                }
+            }, 3) * 1e6 / repeats;
+        };
+        auto exact = Polynomial<double>::multiply(pa, pb, MultiplyAlgorithm::Ntt);
+        auto viaFft = Polynomial<double>::multiply(pa, pb, MultiplyAlgorithm::Fft);
+        double err = 0;
+        for (size_t i = 0; i < exact.coeffs().size(); ++i) {
+            err = std::max(err, std::abs(exact.coeffs()[i] - viaFft.coeffs()[i]));
+        }
+        std::printf("  %8zu %12.2f %12.2f %12.2f %12.2f %12.2f %10.1e\n", n, usFor(MultiplyAlgorithm::Schoolbook),
+                    usFor(MultiplyAlgorithm::Karatsuba), usFor(MultiplyAlgorithm::Fft), usFor(MultiplyAlgorithm::Ntt),
+                    usFor(MultiplyAlgorithm::Auto), err);
+    }
+}
+
+// The division loop RealRootIsolator and SquareFreeDecomposition each had
+// before PolynomialDivider: one pop_back per quotient term.
+static std::vector<double> legacyRemainder(const std::vector<double>& num, const std::vector<double>& den) {
+    std::vector<double> r = num;
+    const size_t dn = den.size() - 1;
+    const double lead = den[dn];
+    while (r.size() > dn) {
+        double q = r.back() / lead;
+        size_t shift = r.size() - 1 - dn;
+        for (size_t i = 0; i <= dn; ++i) {
+            r[shift + i] -= q * den[i];
+        }
+        r.pop_back();
+    }
+    return r;
+}
+
+static void benchDivide() {
+    std::printf("Polynomial division, quotient and divisor of equal length (Auto: Newton from %zu)\n",
+                PolynomialDivider<double>::kNewtonThreshold);
+    std::printf("  %8s %12s %12s %12s %12s %10s\n", "length", "legacy us", "classical us", "newton us", "auto us",
+                "newton err");
+    for (size_t n : { 16, 32, 64, 128, 256, 384, 512, 768, 1024, 2048, 4096, 8192 }) {
+        // A divisor dominated by its leading term keeps the quotient of
+        // num = q * den + r near the size of q, so both methods are accurate.
+        std::vector<double> q = randomValues<double>(n, -1.0, 1.0, static_cast<unsigned>(n));
+        std::vector<double> den = randomValues<double>(n, -0.5 / n, 0.5 / n, static_cast<unsigned>(n) + 1);
+        std::vector<double> rem = randomValues<double>(n - 1, -1.0, 1.0, static_cast<unsigned>(n) + 2);
+        den.back() = 1;
+        Polynomial<double> pden(den);
+        Polynomial<double> num = Polynomial<double>(q) * pden + Polynomial<double>(rem);
+        auto numCoeffs = num.coeffs();
+        std::vector<double> numVec(numCoeffs.begin(), numCoeffs.end());
+
+        const int repeats = static_cast<int>(std::max<size_t>(1, 20000 / n));
+        auto usFor = [&](DivideAlgorithm algorithm) {
+            return secondsFor([&] {
+                for (int r = 0; r < repeats; ++r) g_sink = num.divmod(pden, algorithm).quotient.coeffs()[0];
+            }, 3) * 1e6 / repeats;
+        };
+        double legacy = secondsFor([&] {
+            for (int r = 0; r < repeats; ++r) g_sink = legacyRemainder(numVec, den)[0];
+        }, 3) * 1e6 / repeats;
+
+        auto viaNewton = num.divmod(pden, DivideAlgorithm::Newton);
+        double err = 0;
+        for (size_t i = 0; i < n; ++i) err = std::max(err, std::abs(viaNewton.quotient.coeffs()[i] - q[i]));
+        std::printf("  %8zu %12.2f %12.2f %12.2f %12.2f %10.1e\n", n, legacy, usFor(DivideAlgorithm::Classical),
+                    usFor(DivideAlgorithm::Newton), usFor(DivideAlgorithm::Auto), err);
+    }
+}
+
+static void benchSparse() {
+    std::printf("Sparse vs dense: x^n - 3x^(n/2) + 2x - 1, parse and evaluate at x = 0.999\n");
+    std::printf("  %9s %12s %12s %14s %14s %12s %12s\n", "degree", "dense bytes", "sparse bytes", "parse dense us",
+                "parse sparse us", "dense eval us", "sparse eval us");
+    for (int n : { 16, 64, 256, 1024, 10000, 100000, 1000000 }) {
+        std::string sparseText = "1@" + std::to_string(n) + ", -3@" + std::to_string(n / 2) + ", 2@1, -1";
+        std::vector<double> denseCoeffs(n + 1, 0.0);
+        denseCoeffs[0] = -1;
+        denseCoeffs[1] = 2;
+        denseCoeffs[n / 2] = -3;
+        denseCoeffs[n] = 1;
+        std::string denseText = PolynomialFactory<double>::coefficientsToString(denseCoeffs);
+
+        auto dense = Polynomial<double>::parse(denseText);
+        auto sparse = SparsePolynomial<double>::parse(sparseText);
+        const int repeats = std::max(1, 200000 / n);
+        auto usPer = [&](auto&& body) { return secondsFor([&] { for (int r = 0; r < repeats; ++r) body(); }, 3) * 1e6 / repeats; };
+        double parseDense = usPer([&] { g_sink = Polynomial<double>::parse(denseText).coeffs()[0]; });
+        double parseSparse = usPer([&] { g_sink = static_cast<double>(SparsePolynomial<double>::parse(sparseText).size()); });
+        double evalDense = usPer([&] { g_sink = dense.evaluate(0.999); });
+        double evalSparse = usPer([&] { g_sink = sparse.evaluate(0.999); });
+        std::printf("  %9d %12zu %12zu %14.2f %14.2f %12.2f %12.2f\n", n, dense.coeffs().size_bytes(),
+                    sparse.terms().size_bytes(), parseDense, parseSparse, evalDense, evalSparse);
+    }
+}
+
+static void benchMultipoint() {
+    std::printf("Degree n-1 at n points: per-point Horner vs subproduct tree (tree from %zu complex points in Auto)\n",
+                SubproductTree<std::complex<double>>::kTreeThreshold);
+    std::printf("  %6s %10s %10s %10s %10s %12s %12s %12s\n", "points", "horner us", "build us", "tree us",
+                "interp us", "circle err", "interp err", "real err");
+    using C = std::complex<double>;
+    auto worst = [](double err, double diff) { return diff <= err ? err : diff; };  // keeps NaN
+    for (size_t n : { 16, 64, 256, 512, 1024, 2048, 4096, 8192 }) {
+        std::vector<double> re = randomValues<double>(n, -1.0, 1.0, static_cast<unsigned>(n));
+        std::vector<double> im = randomValues<double>(n, -1.0, 1.0, static_cast<unsigned>(n) + 1);
+        std::vector<C> coeffs(n);
+        for (size_t i = 0; i < n; ++i) coeffs[i] = C(re[i], im[i]);
+        Polynomial<C> p(coeffs);
+        std::vector<C> points(n);
+        for (size_t i = 0; i < n; ++i) points[i] = std::polar(1.0, 2 * std::numbers::pi * (i + 0.5) / n);
+
+        std::vector<C> horner(n), viaTree(n);
+        const int repeats = static_cast<int>(std::max<size_t>(1, 4096 / n));
+        auto usPer = [&](auto&& body) { return secondsFor([&] { for (int r = 0; r < repeats; ++r) body(); }, 3) * 1e6 / repeats; };
+        double hornerUs = usPer([&] { for (size_t i = 0; i < n; ++i) horner[i] = p.evaluate(points[i]); });
+        double buildUs = usPer([&] { g_sink = SubproductTree<C>(points).root().coeffs()[0].real(); });
+        SubproductTree<C> tree(points);
+        double treeUs = usPer([&] { tree.evaluate(p, viaTree); });
+        Polynomial<C> rebuilt = p;
+        double interpUs = usPer([&] { rebuilt = tree.interpolate(horner); });
+
+        double circleErr = 0, interpErr = 0;
+        for (size_t i = 0; i < n; ++i) {
+            circleErr = worst(circleErr, std::abs(viaTree[i] - horner[i]));
+            interpErr = worst(interpErr, std::abs(rebuilt.coeffs()[i] - coeffs[i]));
+        }
+
+        // The same on sorted Chebyshev points in [-1, 1], for the accuracy only.
+        std::vector<double> xs(n), realHorner(n), realTree(n);
+        for (size_t i = 0; i < n; ++i) xs[i] = std::cos(std::numbers::pi * (i + 0.5) / n);
+        Polynomial<double> q(re);
+        q.evaluateMany(xs, realHorner, EvaluationMode::Compensated);
+        SubproductTree<double>(xs).evaluate(q, realTree);
+        double realErr = 0;
+        for (size_t i = 0; i < n; ++i) realErr = worst(realErr, std::abs(realTree[i] - realHorner[i]));
+
+        std::printf("  %6zu %10.1f %10.1f %10.1f %10.1f %12.1e %12.1e %12.1e\n", n, hornerUs, buildUs, treeUs,
+                    interpUs, circleErr, interpErr, realErr);
+    }
+}
+
+static void benchExact() {
+    std::printf("Exact vs double: integer coefficients in [-5, 5], evaluated at x = 3 and 1/3 and squared\n");
+    std::printf("  (p(3) fits in int64 through degree 32; the 2^70 product starts outside it)\n");
+    std::printf("  %6s %12s %12s %12s %12s %12s %12s\n", "degree", "double ns", "exact ns", "exact 1/3 ns",
+                "double mul us", "exact mul us", "2^70 mul us");
+    BigInteger big;
+    BigInteger::tryParse("1180591620717411303424", big);
+    for (int degree : { 4, 16, 32, 64, 256 }) {
+        std::vector<double> values = randomValues<double>(degree + 1, -5.0, 5.0, static_cast<unsigned>(degree));
+        std::vector<double> asDouble;
+        std::vector<Rational> asRational, scaled;
+        for (double v : values) {
+            const auto c = static_cast<long long>(std::round(v));
+            asDouble.push_back(static_cast<double>(c));
+            asRational.push_back(c);
+            scaled.push_back(Rational(big * c + 1));
+        }
+        Polynomial<double> p(asDouble);
+        Polynomial<Rational> exact(asRational);
+        Polynomial<Rational> wide(scaled);
+        const Rational third(1, 3);
+
+        const int repeats = std::max(1, 20000 / degree);
+        auto nsPer = [&](auto&& body) { return secondsFor([&] { for (int r = 0; r < repeats; ++r) body(); }, 3) * 1e9 / repeats; };
+        double evalDouble = nsPer([&] { g_sink = p.evaluate(3.0); });
+        double evalExact = nsPer([&] { g_sink = static_cast<double>(exact.evaluate(3)); });
+        double evalThird = nsPer([&] { g_sink = static_cast<double>(exact.evaluate(third)); });
+        double mulDouble = nsPer([&] { g_sink = (p * p).coeffs()[0]; }) / 1000;
+        double mulExact = nsPer([&] { g_sink = static_cast<double>((exact * exact).coeffs()[0]); }) / 1000;
+        double mulWide = nsPer([&] { g_sink = static_cast<double>((wide * wide).coeffs()[0]); }) / 1000;
+
+        if (static_cast<double>(exact.evaluate(3)) != p.evaluate(3.0) && degree <= 32) {
+            std::printf("  degree %d: exact and double disagree\n", degree);
+        }
+        std::printf("  %6d %12.1f %12.1f %12.1f %12.2f %12.2f %12.2f\n", degree, evalDouble, evalExact, evalThird,
+                    mulDouble, mulExact, mulWide);
+    }
+}
+
+static void benchExpression() {
+    std::printf("Expression grading: expand the prompt once, then parse, compare and check each answer\n");
+    std::printf("  %-28s %12s %12s %12s\n", "expression", "expand us", "grade us", "answer terms");
+    for (const char* text : { "(x+1)^2", "(3x-4)^4", "-x(2x-4)+(3x-4)^2", "(2x-1)^3-x(x+4)/2", "(x+1)^12", "(x-2)^40" }) {
+        const auto key = ExpressionParser<Rational>::parse(text);
+        std::string answer = key.toString();
+        const int repeats = 2000;
+        auto usPer = [&](auto&& body) { return secondsFor([&] { for (int r = 0; r < repeats; ++r) body(); }, 3) * 1e6 / repeats; };
+        double expand = usPer([&] { g_sink = static_cast<double>(ExpressionParser<Rational>::parse(text).degree()); });
+        double grade = usPer([&] {
+            auto parsed = ExpressionParser<Rational>::tryParse(answer);
+            g_sink = parsed && std::ranges::equal(parsed->coeffs(), key.coeffs()) &&
+                     ExpressionParser<Rational>::isExpanded(answer);
+        });
+        std::printf("  %-28s %12.2f %12.2f %12d\n", text, expand, grade, key.degree() + 1);
+    }
+}
+
+static void benchRealRoots() {
+    std::printf("Real roots: solveNewton vs Sturm isolation (1000 random polynomials per degree)\n");
+    std::printf("  %8s %12s %12s %12s %12s %14s\n", "degree", "newton us", "newton bad", "sturm us", "sturm bad", "count-only us");
+    for (int degree : {3, 5, 10}) {
+        std::vector<Polynomial<double>> polys;
+        for (int i = 0; i < 1000; ++i) {
+            polys.emplace_back(randomValues<double>(degree + 1, -5.0, 5.0, 1000 * degree + i));
+        }
+        // A reported root is "bad" if the Sturm count finds nothing within 1e-6 of it.
+        auto countBad = [&](const Polynomial<double>& p, const std::vector<double>& roots) {
+            RealRootIsolator<double> iso(p);
+            int bad = 0;
+            for (double r : roots) bad += iso.countRealRootsIn(r - 1e-6, r + 1e-6) == 0;
+            return bad;
+        };
+
+        int newtonBad = 0;
+        int sturmBad = 0;
+        double newton = secondsFor([&] {
+            newtonBad = 0;
+            for (const auto& p : polys) newtonBad += countBad(p, PolynomialSolver<double>::solveNewton(p));
+        }, 1);
+        double sturm = secondsFor([&] {
+            sturmBad = 0;
+            for (const auto& p : polys) sturmBad += countBad(p, PolynomialSolver<double>::solveReal(p));
+        }, 1);
+        double count = secondsFor([&] {
+            int total = 0;
+            for (const auto& p : polys) total += PolynomialSolver<double>::countRealRootsIn(p, -1.0, 1.0);
+            g_sink = total;
+        }, 1);
+        std::printf("  %8d %12.2f %12d %12.2f %12d %14.2f\n", degree,
+                    newton * 1e6 / polys.size(), newtonBad, sturm * 1e6 / polys.size(), sturmBad,
+                    count * 1e6 / polys.size());
+    }
+}
+
+struct Section {
+    const char* name;
+    std::function<void()> run;
+};
+
+int main(int argc, char** argv) {
+    std::vector<Section> sections = {
+        { "evaluate-many", benchEvaluateMany },
+        { "newton-step", benchNewtonStep },
+        { "solve-allocations", benchSolveAllocations },
+        { "parse", benchParse },
+        { "aberth", benchAberth },
+        { "aberth-scaling", benchAberthScaling },
+        { "engines", benchEngines },
+        { "closed-form", benchClosedForm },
+        { "real-roots", benchRealRoots },
+        { "batch", benchBatch },
+        { "scheduler", benchScheduler },
+        { "streaming", benchStreaming },
+        { "multiplicity", benchMultiplicity },
+        { "escalation", benchEscalation },
+        { "compensated", benchCompensated },
+        { "estrin", benchEstrin },
+        { "multiply", benchMultiply },
+        { "divide", benchDivide },
+        { "sparse", benchSparse },
+        { "multipoint", benchMultipoint },
+        { "exact", benchExact },
+        { "expression", benchExpression },
+    };
+
+    for (const auto& section : sections) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], section.name) == 0) selected = true;
+        }
+        if (selected) {
+            section.run();
+            std::printf("\n");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,374 @@
+#include "AberthSolver.h"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cmath>
+#include <exception>
+#include <numbers>
+#include <system_error>
+#include <thread>
+
+template<typename T>
+std::vector<typename AberthSolver<T>::Complex>
+AberthSolver<T>::normalize(std::span<const Complex> coeffs, int& zeroRoots) {
+    size_t high = coeffs.size();
+    while (high > 0 && coeffs[high - 1] == Complex(0)) --high;
+    if (high == 0) {
+        throw SolverException("Cannot solve the zero polynomial");
+    }
+
+    size_t low = 0;
+    while (low + 1 < high && coeffs[low] == Complex(0)) ++low;
+    zeroRoots = static_cast<int>(low);
+
+    return std::vector<Complex>(coeffs.begin() + low, coeffs.begin() + high);
+}
+
+template<typename T>
+T AberthSolver<T>::cauchyBound(std::span<const Complex> coeffs) {
+    // Unique positive root rho of |a_n| x^n = sum_{i<n} |a_i| x^i. Dividing
+    // through by |a_n| x^n gives 1 = s(1/x), with s increasing in 1/x, which
+    // can be bisected (geometrically) without ever forming x^n.
+    size_t n = coeffs.size() - 1;
+    T lead = std::abs(coeffs[n]);
+    T maxRatio = 0;
+    T maxLow = 0;
+    for (size_t i = 0; i < n; ++i) {
+        maxRatio = std::max(maxRatio, std::abs(coeffs[i]) / lead);
+        if (i > 0) maxLow = std::max(maxLow, std::abs(coeffs[i]));
+    }
+    maxLow = std::max(maxLow, lead);
+
+    T a0 = std::abs(coeffs[0]);
+    T hi = 1 + maxRatio;
+    T lo = a0 / (a0 + maxLow);
+    if (!(lo > 0)) return hi;
+
+    for (int iter = 0; iter < 60 && hi > lo * (1 + T(1e-4)); ++iter) {
+        T mid = std::sqrt(lo * hi);
+        T w = 1 / mid;
+        T s = 0;
+        for (size_t i = 0; i < n; ++i) {
+            s = (s + std::abs(coeffs[i]) / lead) * w;
+        }
+        if (s > 1) lo = mid;
+        else hi = mid;
+    }
+    return hi;
+}
+
+template<typename T>
+std::vector<typename AberthSolver<T>::Complex>
+AberthSolver<T>::initialGuesses(std::span<const Complex> coeffs) {
+    // A single circle of radius rho stalls when one outlying root inflates
+    // the bound, so the points are split over the circles given by the upper
+    // convex hull of (i, log|a_i|) (Bini's Newton polygon), each clamped to rho.
+    const size_t n = coeffs.size() - 1;
+    const T rho = cauchyBound(coeffs);
+
+    std::vector<T> logs(n + 1);
+    std::vector<size_t> hull;
+    for (size_t i = 0; i <= n; ++i) {
+        T m = std::abs(coeffs[i]);
+        if (m == 0) continue;
+        logs[i] = std::log(m);
+        while (hull.size() >= 2) {
+            size_t o = hull[hull.size() - 2];
+            size_t h = hull.back();
+            T cross = static_cast<T>(h - o) * (logs[i] - logs[o]) -
+                      (logs[h] - logs[o]) * static_cast<T>(i - o);
+            if (cross < 0) break;
+            hull.pop_back();
+        }
+        hull.push_back(i);
+    }
+
+    const T twoPi = T(2) * std::numbers::pi_v<T>;
+    // The offset keeps the start points off the real axis and off any symmetry of the roots.
+    const T offset = T(0.7);
+    std::vector<Complex> guesses;
+    guesses.reserve(n);
+    for (size_t e = 0; e + 1 < hull.size(); ++e) {
+        size_t i = hull[e];
+        size_t j = hull[e + 1];
+        size_t count = j - i;
+        T radius = std::min(rho, std::exp((logs[i] - logs[j]) / static_cast<T>(count)));
+        for (size_t k = 0; k < count; ++k) {
+            T angle = twoPi * static_cast<T>(k) / static_cast<T>(count) +
+                      twoPi * static_cast<T>(i) / static_cast<T>(n) + offset;
+            guesses.push_back(std::polar(radius, angle));
+        }
+    }
+    return guesses;
+}
+
+template<typename T>
+typename AberthSolver<T>::Correction
+AberthSolver<T>::newtonCorrection(std::span<const Complex> a, Complex z) {
+    const size_t n = a.size() - 1;
+    const T errorScale = T(4 * n) * std::numeric_limits<T>::epsilon();
+    T az = std::abs(z);
+
+    if (az <= 1) {
+        Complex p = a[n];
+        Complex d = 0;
+        T bound = std::abs(a[n]);
+        for (size_t i = n; i-- > 0;) {
+            d = d * z + p;
+            p = p * z + a[i];
+            bound = bound * az + std::abs(a[i]);
+        }
+        return { p / d, std::abs(p) <= errorScale * bound };
+    }
+
+    // Outside the unit disc evaluate the reversed polynomial at 1/z so that
+    // z^n never has to be formed: p/p' = z q(w) / (n q(w) - w q'(w)).
+    Complex w = Complex(1) / z;
+    T aw = std::abs(w);
+    Complex q = a[0];
+    Complex dq = 0;
+    T bound = std::abs(a[0]);
+    for (size_t i = 1; i <= n; ++i) {
+        dq = dq * w + q;
+        q = q * w + a[i];
+        bound = bound * aw + std::abs(a[i]);
+    }
+    return { z * q / (static_cast<T>(n) * q - w * dq), std::abs(q) <= errorScale * bound };
+}
+
+template<typename T>
+bool AberthSolver<T>::updateRoot(std::span<const Complex> a, std::span<const Complex> z,
+                                 size_t k, T tolerance, Complex& updated) {
+    Complex zk = z[k];
+    Correction c = newtonCorrection(a, zk);
+    if (c.atNoiseLevel) {
+        updated = zk;
+        return true;
+    }
+
+    Complex sum = 0;
+    for (size_t j = 0; j < z.size(); ++j) {
+        if (j != k) sum += Complex(1) / (zk - z[j]);
+    }
+    Complex step = c.ratio / (Complex(1) - c.ratio * sum);
+    if (!std::isfinite(step.real()) || !std::isfinite(step.imag())) {
+        // p'(z) vanished: nudge the estimate and retry next sweep.
+        updated = zk + Complex(T(1e-3), T(1e-3)) * std::max(std::abs(zk), T(1));
+        return false;
+    }
+
+    updated = zk - step;
+    return std::abs(step) <= tolerance * std::abs(updated);
+}
+
+template<typename T>
+SolveResult<T> AberthSolver<T>::collect(std::span<const Complex> z, std::span<const char> converged,
+                                       int zeroRoots, SolveStatus status, int iterations) {
+    SolveResult<T> result;
+    result.status = status;
+    result.iterations = iterations;
+    result.roots.reserve(z.size() + zeroRoots);
+    result.roots.insert(result.roots.end(), zeroRoots, Complex(0));
+    for (size_t k = 0; k < z.size(); ++k) {
+        if (converged[k]) result.roots.push_back(z[k]);
+    }
+    result.converged = result.roots.size();
+    for (size_t k = 0; k < z.size(); ++k) {
+        if (!converged[k]) result.roots.push_back(z[k]);
+    }
+    return result;
+}
+
+template<typename T>
+SolveResult<T> AberthSolver<T>::solve(const Polynomial<Complex>& poly, const SolveBudget& budget,
+                                      T tolerance, int maxIterations, const RootSink<T>& sink) {
+    int zeroRoots = 0;
+    std::vector<Complex> a = normalize(poly.coeffs(), zeroRoots);
+    const size_t n = a.size() - 1;
+    if (sink) {
+        for (int i = 0; i < zeroRoots; ++i) sink(Complex(0), T(0));
+    }
+    if (n == 0) return collect({}, {}, zeroRoots, SolveStatus::Converged, 0);
+
+    // Gauss-Seidel order: each update already sees this sweep's earlier roots.
+    std::vector<Complex> z = initialGuesses(a);
+    std::vector<char> converged(n, 0);
+    size_t remaining = n;
+    SolveStatus status = SolveStatus::Converged;
+
+    int iter = 0;
+    for (; iter < maxIterations && remaining > 0; ++iter) {
+        for (size_t k = 0; k < n; ++k) {
+            if (k % kBudgetPollRoots == 0) {
+                if (auto stop = budget.interruption()) {
+                    status = *stop;
+                    break;
+                }
+            }
+            if (converged[k]) continue;
+            if (updateRoot(a, z, k, tolerance, z[k])) {
+                converged[k] = 1;
+                --remaining;
+                if (sink) sink(z[k], relativeResidual<T>(std::span<const Complex>(a), z[k]));
+            }
+        }
+        if (status != SolveStatus::Converged) break;
+        budget.report(zeroRoots + n - remaining);
+    }
+    if (remaining > 0 && status == SolveStatus::Converged) status = SolveStatus::IterationLimit;
+    return collect(z, converged, zeroRoots, status, iter);
+}
+
+template<typename T>
+SolveResult<T> AberthSolver<T>::solveParallel(const Polynomial<Complex>& poly, const SolveBudget& budget,
+                                              unsigned threads, T tolerance, int maxIterations,
+                                              const RootSink<T>& sink) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+    int zeroRoots = 0;
+    std::vector<Complex> a = normalize(poly.coeffs(), zeroRoots);
+    const size_t n = a.size() - 1;
+    if (threads == 1 || n < 2 * threads) {
+        return solve(poly, budget, tolerance, maxIterations, sink);
+    }
+    if (sink) {
+        for (int i = 0; i < zeroRoots; ++i) sink(Complex(0), T(0));
+    }
+
+    // Jacobi order: every root of a sweep reads the previous sweep's estimates,
+    // so roots can be updated in any order and by any thread.
+    std::vector<Complex> z = initialGuesses(a);
+    std::vector<Complex> next(n);
+    std::vector<char> converged(n, 0);
+    const size_t chunk = std::max<size_t>(16, n / (threads * 8));
+
+    std::atomic<size_t> cursor{0};
+    std::atomic<size_t> remaining{n};
+    std::atomic<bool> stopping{false};
+    int iteration = 0;
+    SolveStatus status = SolveStatus::Converged;
+    bool finished = false;
+    std::vector<char> delivered(sink ? n : 0, 0);
+    std::exception_ptr sinkFailure;
+
+    auto endOfSweep = [&]() noexcept {
+        z.swap(next);
+        cursor.store(0, std::memory_order_relaxed);
+        ++iteration;
+        size_t left = remaining.load(std::memory_order_relaxed);
+        budget.report(zeroRoots + n - left);
+        if (sink && !sinkFailure) {
+            // The completion step runs on one thread, so the sink needs no locking.
+            try {
+                for (size_t k = 0; k < n; ++k) {
+                    if (converged[k] && !delivered[k]) {
+                        delivered[k] = 1;
+                        sink(z[k], relativeResidual<T>(std::span<const Complex>(a), z[k]));
+                    }
+                }
+            } catch (...) {
+                sinkFailure = std::current_exception();
+                finished = true;
+                return;
+            }
+        }
+        if (left == 0) {
+            finished = true;
+        } else if (iteration >= maxIterations) {
+            status = SolveStatus::IterationLimit;
+            finished = true;
+        } else if (auto stop = budget.interruption()) {
+            status = *stop;
+            finished = true;
+        }
+    };
+    std::barrier sweep(static_cast<std::ptrdiff_t>(threads), endOfSweep);
+
+    auto worker = [&]() {
+        while (true) {
+            for (;;) {
+                size_t begin = cursor.fetch_add(chunk, std::memory_order_relaxed);
+                if (begin >= n) break;
+                size_t end = std::min(n, begin + chunk);
+                // Once the budget runs out the rest of the sweep only carries
+                // estimates over, so the swap below never exposes stale slots.
+                if (!stopping.load(std::memory_order_relaxed) && budget.interruption()) {
+                    stopping.store(true, std::memory_order_relaxed);
+                }
+                bool skip = stopping.load(std::memory_order_relaxed);
+                for (size_t k = begin; k < end; ++k) {
+                    if (skip || converged[k]) {
+                        next[k] = z[k];
+                    } else if (updateRoot(a, z, k, tolerance, next[k])) {
+                        converged[k] = 1;
+                        remaining.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+            sweep.arrive_and_wait();
+            if (finished) return;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    try {
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+    } catch (const std::system_error&) {
+        // Threads that did start already count on the barrier's full size;
+        // drop the ones that never will and sweep with the rest.
+        for (size_t missing = threads - 1 - pool.size(); missing > 0; --missing) sweep.arrive_and_drop();
+    }
+    worker();
+    for (auto& thread : pool) thread.join();
+    if (sinkFailure) std::rethrow_exception(sinkFailure);
+
+    return collect(z, converged, zeroRoots, status, iteration);
+}
+
+template<typename T>
+SolveResult<T> AberthSolver<T>::solve(const Polynomial<T>& poly, const SolveBudget& budget,
+                                      T tolerance, int maxIterations, const RootSink<T>& sink) {
+    auto real = poly.coeffs();
+    std::vector<Complex> coeffs(real.begin(), real.end());
+    return solve(Polynomial<Complex>(coeffs), budget, tolerance, maxIterations, sink);
+}
+
+template<typename T>
+SolveResult<T> AberthSolver<T>::solveParallel(const Polynomial<T>& poly, const SolveBudget& budget,
+                                              unsigned threads, T tolerance, int maxIterations,
+                                              const RootSink<T>& sink) {
+    auto real = poly.coeffs();
+    std::vector<Complex> coeffs(real.begin(), real.end());
+    return solveParallel(Polynomial<Complex>(coeffs), budget, threads, tolerance, maxIterations, sink);
+}
+
+template<typename T>
+std::vector<typename AberthSolver<T>::Complex>
+AberthSolver<T>::solve(const Polynomial<Complex>& poly, T tolerance, int maxIterations) {
+    return solve(poly, SolveBudget{}, tolerance, maxIterations).roots;
+}
+
+template<typename T>
+std::vector<typename AberthSolver<T>::Complex>
+AberthSolver<T>::solveParallel(const Polynomial<Complex>& poly, unsigned threads,
+                               T tolerance, int maxIterations) {
+    return solveParallel(poly, SolveBudget{}, threads, tolerance, maxIterations).roots;
+}
+
+template<typename T>
+std::vector<typename AberthSolver<T>::Complex>
+AberthSolver<T>::solve(const Polynomial<T>& poly, T tolerance, int maxIterations) {
+    return solve(poly, SolveBudget{}, tolerance, maxIterations).roots;
+}
+
+template<typename T>
+std::vector<typename AberthSolver<T>::Complex>
+AberthSolver<T>::solveParallel(const Polynomial<T>& poly, unsigned threads,
+                               T tolerance, int maxIterations) {
+    return solveParallel(poly, SolveBudget{}, threads, tolerance, maxIterations).roots;
+}
+
+template class AberthSolver<float>;
+template class AberthSolver<double>;
+template class AberthSolver<long double>;
@@ -0,0 +1,93 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+#include "Polynomial.h"
+#include "SolveBudget.h"
+#include "RootSink.h"
+#include "Exceptions.h"
+
+// Aberth-Ehrlich simultaneous iteration: refines every root of the polynomial
+// at once, so there is no deflation and complex roots come out naturally.
+template<typename T>
+class AberthSolver {
+public:
+    using Complex = std::complex<T>;
+
+    static std::vector<Complex> solve(const Polynomial<Complex>& poly,
+                                      T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                      int maxIterations = 500);
+
+    static std::vector<Complex> solve(const Polynomial<T>& poly,
+                                      T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                      int maxIterations = 500);
+
+    // Jacobi-style sweeps with the roots split into chunks that worker threads
+    // claim dynamically, and a barrier between sweeps. threads == 0 means one
+    // per hardware thread.
+    static std::vector<Complex> solveParallel(const Polynomial<Complex>& poly,
+                                              unsigned threads = 0,
+                                              T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                              int maxIterations = 500);
+
+    static std::vector<Complex> solveParallel(const Polynomial<T>& poly,
+                                              unsigned threads = 0,
+                                              T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                              int maxIterations = 500);
+
+    // Budgeted forms: the deadline and cancel flag are checked every
+    // kBudgetPollRoots root updates and progress counts settled roots. A stopped solve still returns
+    // every estimate, converged ones first.
+    static SolveResult<T> solve(const Polynomial<Complex>& poly, const SolveBudget& budget,
+                                T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                int maxIterations = 500,
+                                const RootSink<T>& sink = {});
+
+    static SolveResult<T> solve(const Polynomial<T>& poly, const SolveBudget& budget,
+                                T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                int maxIterations = 500,
+                                const RootSink<T>& sink = {});
+
+    static SolveResult<T> solveParallel(const Polynomial<Complex>& poly, const SolveBudget& budget,
+                                        unsigned threads = 0,
+                                        T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                        int maxIterations = 500,
+                                        const RootSink<T>& sink = {});
+
+    static SolveResult<T> solveParallel(const Polynomial<T>& poly, const SolveBudget& budget,
+                                        unsigned threads = 0,
+                                        T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                        int maxIterations = 500,
+                                        const RootSink<T>& sink = {});
+
+    static constexpr size_t kBudgetPollRoots = 64;
+
+    // Below this degree a sweep is too short to be worth splitting across threads.
+    static constexpr int kParallelDegree = 512;
+
+    // Start points on Newton-polygon circles, none outside Cauchy's bound.
+    static std::vector<Complex> initialGuesses(std::span<const Complex> coeffs);
+
+    static T cauchyBound(std::span<const Complex> coeffs);
+
+private:
+    struct Correction {
+        Complex ratio;      // p(z) / p'(z)
+        bool atNoiseLevel;  // |p(z)| is within Horner's rounding error bound
+    };
+
+    static Correction newtonCorrection(std::span<const Complex> coeffs, Complex z);
+
+    // One Aberth step for root k against the estimates in z; true once it has converged.
+    static bool updateRoot(std::span<const Complex> coeffs, std::span<const Complex> z,
+                           size_t k, T tolerance, Complex& updated);
+
+    // Drops zero leading coefficients and factors out exact zero roots.
+    static std::vector<Complex> normalize(std::span<const Complex> coeffs, int& zeroRoots);
+
+    // Exact zero roots, then converged estimates, then the rest.
+    static SolveResult<T> collect(std::span<const Complex> z, std::span<const char> converged,
+                                  int zeroRoots, SolveStatus status, int iterations);
+};
@@ -0,0 +1,314 @@
+#include "BigInteger.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+using Limbs = std::vector<std::uint32_t>;
+
+void trimZeros(Limbs& a) {
+    while (!a.empty() && a.back() == 0) a.pop_back();
+}
+
+int compareMagnitude(const Limbs& a, const Limbs& b) {
+    if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+    for (size_t i = a.size(); i-- > 0;) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+Limbs addMagnitude(const Limbs& a, const Limbs& b) {
+    const Limbs& longer = a.size() >= b.size() ? a : b;
+    const Limbs& shorter = a.size() >= b.size() ? b : a;
+    Limbs sum(longer.size() + 1);
+    std::uint64_t carry = 0;
+    for (size_t i = 0; i < longer.size(); ++i) {
+        carry += longer[i];
+        if (i < shorter.size()) carry += shorter[i];
+        sum[i] = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+    sum.back() = static_cast<std::uint32_t>(carry);
+    trimZeros(sum);
+    return sum;
+}
+
+// a - b for |a| >= |b|.
+Limbs subtractMagnitude(const Limbs& a, const Limbs& b) {
+    Limbs diff(a.size());
+    std::int64_t borrow = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        std::int64_t d = static_cast<std::int64_t>(a[i]) - borrow - (i < b.size() ? b[i] : 0);
+        borrow = d < 0;
+        diff[i] = static_cast<std::uint32_t>(d + (borrow << 32));
+    }
+    trimZeros(diff);
+    return diff;
+}
+
+Limbs multiplyMagnitude(const Limbs& a, const Limbs& b) {
+    if (a.empty() || b.empty()) return {};
+    Limbs product(a.size() + b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        std::uint64_t carry = 0;
+        for (size_t j = 0; j < b.size(); ++j) {
+            carry += static_cast<std::uint64_t>(a[i]) * b[j] + product[i + j];
+            product[i + j] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        product[i + b.size()] = static_cast<std::uint32_t>(carry);
+    }
+    trimZeros(product);
+    return product;
+}
+
+// a / d in place; returns a mod d.
+std::uint32_t divideBySmall(Limbs& a, std::uint32_t d) {
+    std::uint64_t rem = 0;
+    for (size_t i = a.size(); i-- > 0;) {
+        std::uint64_t cur = (rem << 32) | a[i];
+        a[i] = static_cast<std::uint32_t>(cur / d);
+        rem = cur % d;
+    }
+    trimZeros(a);
+    return static_cast<std::uint32_t>(rem);
+}
+
+// Knuth's algorithm D: quotient and remainder of magnitudes, |b| >= 2 limbs.
+void divideMagnitude(const Limbs& a, const Limbs& b, Limbs& q, Limbs& r) {
+    // Normalize so the divisor's top limb has its high bit set; each
+    // estimated quotient digit is then at most two too large.
+    int shift = 0;
+    for (std::uint32_t top = b.back(); !(top & 0x80000000u); top <<= 1) ++shift;
+    auto shifted = [shift](const Limbs& x, size_t extra) {
+        Limbs out(x.size() + extra, 0);
+        for (size_t i = 0; i < x.size(); ++i) {
+            std::uint64_t v = static_cast<std::uint64_t>(x[i]) << shift;
+            out[i] |= static_cast<std::uint32_t>(v);
+            if (i + 1 < out.size()) out[i + 1] |= static_cast<std::uint32_t>(v >> 32);
+        }
+        return out;
+    };
+    Limbs u = shifted(a, 1);
+    const Limbs v = shifted(b, 0);
+    const size_t n = v.size();
+    const size_t m = a.size() - n;
+
+    q.assign(m + 1, 0);
+    for (size_t j = m + 1; j-- > 0;) {
+        std::uint64_t numerator = (static_cast<std::uint64_t>(u[j + n]) << 32) | u[j + n - 1];
+        std::uint64_t qhat = numerator / v[n - 1];
+        std::uint64_t rhat = numerator % v[n - 1];
+        while (qhat > 0xFFFFFFFFull || qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2])) {
+            --qhat;
+            rhat += v[n - 1];
+            if (rhat > 0xFFFFFFFFull) break;
+        }
+
+        // u[j .. j+n] -= qhat * v
+        std::int64_t borrow = 0;
+        std::uint64_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            carry += qhat * v[i];
+            std::int64_t d = static_cast<std::int64_t>(u[i + j]) - borrow - static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+            borrow = d < 0;
+            u[i + j] = static_cast<std::uint32_t>(d + (borrow << 32));
+        }
+        std::int64_t d = static_cast<std::int64_t>(u[j + n]) - borrow - static_cast<std::int64_t>(carry);
+        u[j + n] = static_cast<std::uint32_t>(d);
+
+        if (d < 0) {
+            // qhat was one too large: add v back.
+            --qhat;
+            std::uint64_t sum = 0;
+            for (size_t i = 0; i < n; ++i) {
+                sum += static_cast<std::uint64_t>(u[i + j]) + v[i];
+                u[i + j] = static_cast<std::uint32_t>(sum);
+                sum >>= 32;
+            }
+            u[j + n] += static_cast<std::uint32_t>(sum);
+        }
+        q[j] = static_cast<std::uint32_t>(qhat);
+    }
+    trimZeros(q);
+
+    // Undo the normalization on the remainder.
+    r.assign(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        std::uint64_t v2 = u[i] >> shift;
+        if (shift > 0 && i + 1 < u.size()) v2 |= static_cast<std::uint64_t>(u[i + 1]) << (32 - shift);
+        r[i] = static_cast<std::uint32_t>(v2);
+    }
+    trimZeros(r);
+}
+
+}  // namespace
+
+BigInteger BigInteger::fromMagnitude(bool negative, Limbs magnitude) {
+    trimZeros(magnitude);
+    if (magnitude.size() <= 2) {
+        std::uint64_t value = 0;
+        for (size_t i = magnitude.size(); i-- > 0;) value = (value << 32) | magnitude[i];
+        constexpr std::uint64_t maxPositive = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+        if (value <= maxPositive) {
+            return BigInteger(negative ? -static_cast<std::int64_t>(value) : static_cast<std::int64_t>(value));
+        }
+        if (negative && value == maxPositive + 1) return BigInteger(std::numeric_limits<std::int64_t>::min());
+    }
+    BigInteger result;
+    result.negative_ = negative;
+    result.limbs_ = std::move(magnitude);
+    return result;
+}
+
+BigInteger::Limbs BigInteger::magnitudeOf(const BigInteger& a) {
+    if (!a.isSmall()) return a.limbs_;
+    // Negating in unsigned arithmetic is exact for int64's minimum as well.
+    std::uint64_t value = a.small_ < 0 ? 0 - static_cast<std::uint64_t>(a.small_) : static_cast<std::uint64_t>(a.small_);
+    Limbs limbs = { static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32) };
+    trimZeros(limbs);
+    return limbs;
+}
+
+int BigInteger::compare(const BigInteger& a, const BigInteger& b) {
+    if (a.sign() != b.sign()) return a.sign() < b.sign() ? -1 : 1;
+    int magnitude = compareMagnitude(magnitudeOf(a), magnitudeOf(b));
+    return a.isNegative() ? -magnitude : magnitude;
+}
+
+BigInteger BigInteger::addSlow(const BigInteger& a, const BigInteger& b, bool subtract) {
+    const bool negA = a.isNegative();
+    const bool negB = b.isNegative() != subtract;
+    Limbs ma = magnitudeOf(a);
+    Limbs mb = magnitudeOf(b);
+    if (negA == negB) return fromMagnitude(negA, addMagnitude(ma, mb));
+    if (compareMagnitude(ma, mb) >= 0) return fromMagnitude(negA, subtractMagnitude(ma, mb));
+    return fromMagnitude(negB, subtractMagnitude(mb, ma));
+}
+
+BigInteger BigInteger::multiplySlow(const BigInteger& a, const BigInteger& b) {
+    return fromMagnitude(a.isNegative() != b.isNegative(), multiplyMagnitude(magnitudeOf(a), magnitudeOf(b)));
+}
+
+BigInteger BigInteger::operator-() const {
+    if (isSmall() && small_ != std::numeric_limits<std::int64_t>::min()) return BigInteger(-small_);
+    return fromMagnitude(!isNegative(), magnitudeOf(*this));
+}
+
+void BigInteger::divMod(const BigInteger& a, const BigInteger& b, BigInteger& q, BigInteger& r) {
+    if (b.isZero()) throw std::domain_error("BigInteger division by zero");
+    if (a.isSmall() && b.isSmall() &&
+        !(a.small_ == std::numeric_limits<std::int64_t>::min() && b.small_ == -1)) {
+        q = BigInteger(a.small_ / b.small_);
+        r = BigInteger(a.small_ % b.small_);
+        return;
+    }
+
+    Limbs ma = magnitudeOf(a);
+    Limbs mb = magnitudeOf(b);
+    Limbs mq, mr;
+    if (compareMagnitude(ma, mb) < 0) {
+        mr = ma;
+    } else if (mb.size() == 1) {
+        mq = ma;
+        mr = { divideBySmall(mq, mb[0]) };
+    } else {
+        divideMagnitude(ma, mb, mq, mr);
+    }
+    q = fromMagnitude(a.isNegative() != b.isNegative(), std::move(mq));
+    r = fromMagnitude(a.isNegative(), std::move(mr));
+}
+
+BigInteger BigInteger::gcd(const BigInteger& a, const BigInteger& b) {
+    if (a.isSmall() && b.isSmall()) {
+        auto magnitude = [](std::int64_t v) {
+            return v < 0 ? 0 - static_cast<std::uint64_t>(v) : static_cast<std::uint64_t>(v);
+        };
+        std::uint64_t g = std::gcd(magnitude(a.small_), magnitude(b.small_));
+        return BigInteger(g);
+    }
+    BigInteger x = abs(a);
+    BigInteger y = abs(b);
+    while (!y.isZero()) {
+        BigInteger r = x % y;
+        x = std::move(y);
+        y = std::move(r);
+    }
+    return x;
+}
+
+BigInteger::operator double() const {
+    if (isSmall()) return static_cast<double>(small_);
+    double value = 0;
+    for (size_t i = limbs_.size(); i-- > 0;) value = value * 4294967296.0 + limbs_[i];
+    return negative_ ? -value : value;
+}
+
+double frexp(const BigInteger& a, int* exponent) {
+    if (a.isSmall()) return std::frexp(static_cast<double>(a.small_), exponent);
+    // The top three limbs carry more than double's 53 bits.
+    const size_t top = std::min<size_t>(a.limbs_.size(), 3);
+    double value = 0;
+    for (size_t i = 0; i < top; ++i) value = value * 4294967296.0 + a.limbs_[a.limbs_.size() - 1 - i];
+    double mantissa = std::frexp(a.negative_ ? -value : value, exponent);
+    *exponent += static_cast<int>(32 * (a.limbs_.size() - top));
+    return mantissa;
+}
+
+std::string BigInteger::toString() const {
+    if (isSmall()) return std::to_string(small_);
+    // Nine decimal digits at a time, least significant group first.
+    Limbs rest = limbs_;
+    std::vector<std::uint32_t> groups;
+    while (!rest.empty()) groups.push_back(divideBySmall(rest, 1000000000u));
+
+    std::string text = negative_ ? "-" : "";
+    text += std::to_string(groups.back());
+    for (size_t i = groups.size() - 1; i-- > 0;) {
+        std::string group = std::to_string(groups[i]);
+        text.append(9 - group.size(), '0');
+        text += group;
+    }
+    return text;
+}
+
+bool BigInteger::tryParse(std::string_view text, BigInteger& out) {
+    bool negative = false;
+    if (!text.empty() && (text.front() == '+' || text.front() == '-')) {
+        negative = text.front() == '-';
+        text.remove_prefix(1);
+    }
+    if (text.empty() || !std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        return false;
+    }
+
+    // Up to 18 digits always fit in int64.
+    if (text.size() <= 18) {
+        std::int64_t value = 0;
+        std::from_chars(text.data(), text.data() + text.size(), value);
+        out = BigInteger(negative ? -value : value);
+        return true;
+    }
+
+    Limbs magnitude;
+    size_t first = text.size() % 9 == 0 ? 9 : text.size() % 9;
+    for (size_t start = 0; start < text.size(); start = first, first += 9) {
+        std::uint32_t group = 0;
+        std::from_chars(text.data() + start, text.data() + first, group);
+        // magnitude = magnitude * 10^9 + group
+        std::uint64_t carry = group;
+        for (auto& limb : magnitude) {
+            carry += static_cast<std::uint64_t>(limb) * 1000000000u;
+            limb = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        if (carry) magnitude.push_back(static_cast<std::uint32_t>(carry));
+    }
+    out = fromMagnitude(negative, std::move(magnitude));
+    return true;
+}
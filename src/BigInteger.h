@@ -0,0 +1,208 @@
+#pragma once
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// Overflow-checked int64 arithmetic: true when the exact result does not fit,
+// in which case out is unspecified.
+inline bool addOverflows(std::int64_t a, std::int64_t b, std::int64_t& out) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_add_overflow(a, b, &out);
+#else
+    out = static_cast<std::int64_t>(static_cast<std::uint64_t>(a) + static_cast<std::uint64_t>(b));
+    return (a >= 0) == (b >= 0) && (out >= 0) != (a >= 0);
+#endif
+}
+
+inline bool subOverflows(std::int64_t a, std::int64_t b, std::int64_t& out) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_sub_overflow(a, b, &out);
+#else
+    out = static_cast<std::int64_t>(static_cast<std::uint64_t>(a) - static_cast<std::uint64_t>(b));
+    return (a >= 0) != (b >= 0) && (out >= 0) != (a >= 0);
+#endif
+}
+
+inline bool mulOverflows(std::int64_t a, std::int64_t b, std::int64_t& out) {
+#if defined(__SIZEOF_INT128__)
+    __int128 product = static_cast<__int128>(a) * b;
+    out = static_cast<std::int64_t>(product);
+    return product != out;
+#elif defined(_MSC_VER) && defined(_M_X64)
+    std::int64_t high;
+    out = _mul128(a, b, &high);
+    return high != (out >> 63);
+#else
+    if (a == 0 || b == 0) {
+        out = 0;
+        return false;
+    }
+    if ((a == -1 && b == std::numeric_limits<std::int64_t>::min()) ||
+        (b == -1 && a == std::numeric_limits<std::int64_t>::min())) {
+        return true;
+    }
+    out = static_cast<std::int64_t>(static_cast<std::uint64_t>(a) * static_cast<std::uint64_t>(b));
+    return out / b != a;
+#endif
+}
+
+// Arbitrary-precision integer. Values that fit in int64 are held and operated
+// on as a plain int64, with every operation checked for overflow; only a
+// result that does not fit moves to 32-bit limbs. Exact polynomial arithmetic
+// on problem-sized integers therefore never leaves the fast path.
+class BigInteger {
+public:
+    constexpr BigInteger() = default;
+
+    template<std::signed_integral I>
+    constexpr BigInteger(I value) : small_(value) {}
+
+    template<std::unsigned_integral U>
+    BigInteger(U value) {
+        if (value <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())) {
+            small_ = static_cast<std::int64_t>(value);
+        } else {
+            const auto wide = static_cast<std::uint64_t>(value);
+            *this = fromMagnitude(false, { static_cast<std::uint32_t>(wide), static_cast<std::uint32_t>(wide >> 32) });
+        }
+    }
+
+    // Decimal digits with an optional sign; false, leaving out unchanged, on
+    // anything else.
+    static bool tryParse(std::string_view text, BigInteger& out);
+
+    bool isSmall() const { return limbs_.empty(); }
+    bool isZero() const { return isSmall() && small_ == 0; }
+    bool isOne() const { return isSmall() && small_ == 1; }
+    bool isNegative() const { return isSmall() ? small_ < 0 : negative_; }
+    int sign() const { return isSmall() ? (small_ > 0) - (small_ < 0) : (negative_ ? -1 : 1); }
+
+    // Only meaningful when isSmall().
+    std::int64_t small() const { return small_; }
+
+    explicit operator double() const;
+    std::string toString() const;
+
+    BigInteger operator-() const;
+
+    friend BigInteger operator+(const BigInteger& a, const BigInteger& b) {
+        std::int64_t r;
+        if (a.isSmall() && b.isSmall() && !addOverflows(a.small_, b.small_, r)) return BigInteger(r);
+        return addSlow(a, b, false);
+    }
+
+    friend BigInteger operator-(const BigInteger& a, const BigInteger& b) {
+        std::int64_t r;
+        if (a.isSmall() && b.isSmall() && !subOverflows(a.small_, b.small_, r)) return BigInteger(r);
+        return addSlow(a, b, true);
+    }
+
+    friend BigInteger operator*(const BigInteger& a, const BigInteger& b) {
+        std::int64_t r;
+        if (a.isSmall() && b.isSmall() && !mulOverflows(a.small_, b.small_, r)) return BigInteger(r);
+        return multiplySlow(a, b);
+    }
+
+    // Truncating, like the built-in types; throws std::domain_error on zero.
+    friend BigInteger operator/(const BigInteger& a, const BigInteger& b) {
+        BigInteger q, r;
+        divMod(a, b, q, r);
+        return q;
+    }
+
+    friend BigInteger operator%(const BigInteger& a, const BigInteger& b) {
+        BigInteger q, r;
+        divMod(a, b, q, r);
+        return r;
+    }
+
+    // a = q * b + r with q truncated toward zero and r taking a's sign.
+    static void divMod(const BigInteger& a, const BigInteger& b, BigInteger& q, BigInteger& r);
+
+    // Non-negative; gcd(0, 0) is 0.
+    static BigInteger gcd(const BigInteger& a, const BigInteger& b);
+
+    // In place on the fast path, so accumulating loops build no temporaries.
+    BigInteger& operator+=(const BigInteger& b) {
+        std::int64_t r;
+        if (isSmall() && b.isSmall() && !addOverflows(small_, b.small_, r)) {
+            small_ = r;
+            return *this;
+        }
+        return *this = addSlow(*this, b, false);
+    }
+    BigInteger& operator-=(const BigInteger& b) {
+        std::int64_t r;
+        if (isSmall() && b.isSmall() && !subOverflows(small_, b.small_, r)) {
+            small_ = r;
+            return *this;
+        }
+        return *this = addSlow(*this, b, true);
+    }
+    BigInteger& operator*=(const BigInteger& b) {
+        std::int64_t r;
+        if (isSmall() && b.isSmall() && !mulOverflows(small_, b.small_, r)) {
+            small_ = r;
+            return *this;
+        }
+        return *this = multiplySlow(*this, b);
+    }
+    BigInteger& operator/=(const BigInteger& b) { return *this = *this / b; }
+    BigInteger& operator%=(const BigInteger& b) { return *this = *this % b; }
+
+    friend bool operator==(const BigInteger& a, const BigInteger& b) {
+        if (a.isSmall() || b.isSmall()) return a.isSmall() && b.isSmall() && a.small_ == b.small_;
+        return a.negative_ == b.negative_ && a.limbs_ == b.limbs_;
+    }
+    friend bool operator!=(const BigInteger& a, const BigInteger& b) { return !(a == b); }
+    friend bool operator<(const BigInteger& a, const BigInteger& b) {
+        if (a.isSmall() && b.isSmall()) return a.small_ < b.small_;
+        return compare(a, b) < 0;
+    }
+    friend bool operator>(const BigInteger& a, const BigInteger& b) { return b < a; }
+    friend bool operator<=(const BigInteger& a, const BigInteger& b) { return !(b < a); }
+    friend bool operator>=(const BigInteger& a, const BigInteger& b) { return !(a < b); }
+
+    friend BigInteger abs(const BigInteger& a) { return a.isNegative() ? -a : a; }
+
+    // Like std::frexp: a = result * 2^exponent with |result| in [0.5, 1),
+    // or 0 for zero; finite however many limbs a has.
+    friend double frexp(const BigInteger& a, int* exponent);
+
+    friend std::ostream& operator<<(std::ostream& os, const BigInteger& a) { return os << a.toString(); }
+
+private:
+    using Limbs = std::vector<std::uint32_t>;
+
+    std::int64_t small_ = 0;   // the value, while limbs_ is empty
+    bool negative_ = false;    // sign of a large value
+    Limbs limbs_;              // magnitude of a large value, least significant first
+
+    // Limbs without leading zeros; a value that fits in int64 comes back small.
+    static BigInteger fromMagnitude(bool negative, Limbs magnitude);
+    static Limbs magnitudeOf(const BigInteger& a);
+    static int compare(const BigInteger& a, const BigInteger& b);
+
+    static BigInteger addSlow(const BigInteger& a, const BigInteger& b, bool subtract);
+    static BigInteger multiplySlow(const BigInteger& a, const BigInteger& b);
+};
+
+// Generic code picks tolerances from numeric_limits; exact types get zero.
+template<>
+struct std::numeric_limits<BigInteger> {
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool is_bounded = false;
+    static constexpr int radix = 2;
+    static BigInteger epsilon() { return 0; }
+};
@@ -0,0 +1,209 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numbers>
+#include <span>
+#include "Exceptions.h"
+
+// Up to four roots without touching the heap.
+template<typename T>
+struct ClosedFormRoots {
+    std::array<std::complex<T>, 4> roots{};
+    int count = 0;
+
+    void push(std::complex<T> z) { roots[count++] = z; }
+    const std::complex<T>* begin() const { return roots.data(); }
+    const std::complex<T>* end() const { return roots.data() + count; }
+};
+
+// Direct formulas for degree <= 4, each written to avoid the textbook
+// cancellations, followed by a short Newton polish against the input.
+template<typename T>
+class ClosedFormSolver {
+public:
+    using Complex = std::complex<T>;
+
+    static constexpr int kMaxDegree = 4;
+
+    // Ascending coefficients; the leading one must be non-zero.
+    static ClosedFormRoots<T> solve(std::span<const T> coeffs) {
+        size_t high = coeffs.size();
+        while (high > 0 && coeffs[high - 1] == 0) --high;
+        if (high == 0) {
+            throw SolverException("Cannot solve the zero polynomial");
+        }
+        if (high - 1 > kMaxDegree) {
+            throw SolverException("Closed-form solver handles degree 4 at most");
+        }
+
+        ClosedFormRoots<T> out;
+        switch (high - 1) {
+            case 1: out.push(Complex(-coeffs[0] / coeffs[1])); break;
+            case 2: quadratic(coeffs[2], coeffs[1], coeffs[0], out); break;
+            case 3: cubic(coeffs[2] / coeffs[3], coeffs[1] / coeffs[3], coeffs[0] / coeffs[3], out); break;
+            case 4: quartic(coeffs[3] / coeffs[4], coeffs[2] / coeffs[4],
+                            coeffs[1] / coeffs[4], coeffs[0] / coeffs[4], out); break;
+            default: break;
+        }
+
+        for (int i = 0; i < out.count; ++i) {
+            out.roots[i] = polish(coeffs.first(high), out.roots[i]);
+        }
+        return out;
+    }
+
+    // a x^2 + b x + c in the citardauq form: the larger-magnitude root comes
+    // from the sum without cancellation, the other from c / q (Vieta).
+    static void quadratic(T a, T b, T c, ClosedFormRoots<T>& out) {
+        T disc = discriminant(a, b, c);
+        if (disc >= 0) {
+            T q = -(b + std::copysign(std::sqrt(disc), b)) / 2;
+            if (q == 0) {
+                out.push(Complex(0));
+                out.push(Complex(0));
+                return;
+            }
+            out.push(Complex(q / a));
+            out.push(Complex(c / q));
+        } else {
+            T re = -b / (2 * a);
+            T im = std::sqrt(-disc) / (2 * std::abs(a));
+            out.push(Complex(re, im));
+            out.push(Complex(re, -im));
+        }
+    }
+
+    // x^3 + a x^2 + b x + c: trigonometric form for three real roots,
+    // Cardano otherwise.
+    static void cubic(T a, T b, T c, ClosedFormRoots<T>& out) {
+        const T third = a / 3;
+        T q = (a * a - 3 * b) / 9;
+        T r = (2 * a * a * a - 9 * a * b + 27 * c) / 54;
+        T q3 = q * q * q;
+
+        if (r * r < q3) {
+            T theta = std::acos(std::clamp(r / std::sqrt(q3), T(-1), T(1)));
+            T scale = -2 * std::sqrt(q);
+            const T twoPi = 2 * std::numbers::pi_v<T>;
+            out.push(Complex(scale * std::cos(theta / 3) - third));
+            out.push(Complex(scale * std::cos((theta + twoPi) / 3) - third));
+            out.push(Complex(scale * std::cos((theta - twoPi) / 3) - third));
+            return;
+        }
+
+        T big = -std::copysign(std::cbrt(std::abs(r) + std::sqrt(r * r - q3)), r);
+        T small = big != 0 ? q / big : T(0);
+        T sum = big + small;
+        T im = std::sqrt(T(3)) / 2 * (big - small);
+        out.push(Complex(sum - third));
+        out.push(Complex(-sum / 2 - third, im));
+        out.push(Complex(-sum / 2 - third, -im));
+    }
+
+    // x^4 + a x^3 + b x^2 + c x + d by Ferrari: depress with x = y - a/4,
+    // then split y^4 + p y^2 + q y + r into two quadratics using a positive
+    // root m of the resolvent cubic.
+    static void quartic(T a, T b, T c, T d, ClosedFormRoots<T>& out) {
+        const T shift = a / 4;
+        T a2 = a * a;
+        T p = b - T(3) / 8 * a2;
+        T q = c - a * b / 2 + a2 * a / 8;
+        T r = d - a * c / 4 + a2 * b / 16 - T(3) / 256 * a2 * a2;
+
+        ClosedFormRoots<T> y;
+        T scale = std::abs(p) + std::abs(r) + 1;
+        if (std::abs(q) <= std::numeric_limits<T>::epsilon() * scale) {
+            // Biquadratic: y^2 = z for both roots z of z^2 + p z + r.
+            ClosedFormRoots<T> z;
+            quadratic(T(1), p, r, z);
+            for (int i = 0; i < z.count; ++i) {
+                Complex s = std::sqrt(z.roots[i]);
+                y.push(s);
+                y.push(-s);
+            }
+        } else {
+            ClosedFormRoots<T> resolvent;
+            cubic(p, p * p / 4 - r, -q * q / 8, resolvent);
+            T m = 0;
+            for (int i = 0; i < resolvent.count; ++i) {
+                if (std::abs(resolvent.roots[i].imag()) <= std::numeric_limits<T>::epsilon() * scale) {
+                    m = std::max(m, resolvent.roots[i].real());
+                }
+            }
+            T s = std::sqrt(2 * m);
+            T t = q / (2 * s);
+            complexQuadratic(Complex(s), Complex(p / 2 + m - t), y);
+            complexQuadratic(Complex(-s), Complex(p / 2 + m + t), y);
+        }
+
+        for (int i = 0; i < y.count; ++i) {
+            out.push(y.roots[i] - shift);
+        }
+    }
+
+private:
+    // b^2 - 4ac with Kahan's FMA correction for the cancelling case.
+    static T discriminant(T a, T b, T c) {
+        T w = 4 * a * c;
+        T e = std::fma(-4 * a, c, w);
+        return std::fma(b, b, -w) + e;
+    }
+
+    // Monic y^2 + b y + c with complex coefficients.
+    static void complexQuadratic(Complex b, Complex c, ClosedFormRoots<T>& out) {
+        Complex root = std::sqrt(b * b - T(4) * c);
+        if (std::real(std::conj(b) * root) < 0) root = -root;
+        Complex q = -(b + root) / T(2);
+        if (q == Complex(0)) {
+            out.push(Complex(0));
+            out.push(Complex(0));
+            return;
+        }
+        out.push(q);
+        out.push(c / q);
+    }
+
+    // Newton steps on the input for as long as they shrink the residual;
+    // a few at most, since the formulas already land within a few ulps
+    // except where cancellation in the depressed form bit.
+    static Complex polish(std::span<const T> coeffs, Complex z) {
+        const bool real = z.imag() == 0;
+        Complex p = evaluate(coeffs, z);
+        for (int step = 0; step < kPolishSteps && p != Complex(0); ++step) {
+            Complex d = derivative(coeffs, z);
+            if (d == Complex(0)) break;
+
+            Complex next = z - p / d;
+            if (real) next = Complex(next.real());
+            if (!std::isfinite(next.real()) || !std::isfinite(next.imag())) break;
+
+            Complex pn = evaluate(coeffs, next);
+            if (!(std::abs(pn) < std::abs(p))) break;
+            z = next;
+            p = pn;
+        }
+        return z;
+    }
+
+    static Complex evaluate(std::span<const T> coeffs, Complex z) {
+        Complex p = coeffs.back();
+        for (size_t i = coeffs.size() - 1; i-- > 0;) {
+            p = p * z + coeffs[i];
+        }
+        return p;
+    }
+
+    static Complex derivative(std::span<const T> coeffs, Complex z) {
+        size_t n = coeffs.size() - 1;
+        Complex d = T(n) * coeffs[n];
+        for (size_t i = n - 1; i >= 1; --i) {
+            d = d * z + T(i) * coeffs[i];
+        }
+        return d;
+    }
+
+    static constexpr int kPolishSteps = 4;
+};
@@ -0,0 +1,205 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+enum class ParseErrorCode {
+    None,
+    NoCoefficients,
+    InvalidNumber,
+    InvalidExponent,
+    InvalidExpression,
+    OutOfRange
+};
+
+struct ParseError {
+    ParseErrorCode code = ParseErrorCode::None;
+    std::size_t position = 0;  // offset of the offending token in the input
+    std::string_view token;
+
+    explicit operator bool() const { return code != ParseErrorCode::None; }
+};
+
+// coefficient * x^exponent; one entry of a sparse term list.
+template<typename T>
+struct SparseTerm {
+    int exponent;
+    T coefficient;
+};
+
+// Coefficients from many inputs packed back to back; input i owns
+// values[offsets[i], offsets[i + 1]).
+template<typename T>
+struct CoefficientBuffer {
+    std::vector<T> values;
+    std::vector<std::size_t> offsets;
+    std::vector<ParseError> errors;
+
+    std::size_t size() const { return errors.size(); }
+
+    std::span<const T> operator[](std::size_t i) const {
+        return std::span<const T>(values.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+};
+
+// Comma-separated coefficient lists over string_view with std::from_chars;
+// nothing here throws or allocates beyond the caller's output container.
+template<typename T>
+class CoefficientParser {
+public:
+    static ParseErrorCode parseNumber(std::string_view token, T& out) {
+        if (!token.empty() && token.front() == '+') token.remove_prefix(1);
+        if (token.empty()) return ParseErrorCode::InvalidNumber;
+
+        const char* first = token.data();
+        const char* last = first + token.size();
+        std::from_chars_result result;
+        if constexpr (std::is_arithmetic_v<T>) {
+            result = std::from_chars(first, last, out);
+        } else if constexpr (requires { { T::tryParse(token, out) } -> std::same_as<bool>; }) {
+            // Exact types (Rational, BigInteger) bring their own parser.
+            return T::tryParse(token, out) ? ParseErrorCode::None : ParseErrorCode::InvalidNumber;
+        } else {
+            double value = 0;
+            result = std::from_chars(first, last, value);
+            out = T(value);
+        }
+
+        if (result.ec == std::errc::result_out_of_range) return ParseErrorCode::OutOfRange;
+        if (result.ec != std::errc() || result.ptr != last) return ParseErrorCode::InvalidNumber;
+        return ParseErrorCode::None;
+    }
+
+    // Appends every coefficient in text to out (anything with push_back).
+    // Blank tokens are skipped; on error out keeps the values parsed so far.
+    template<typename Container>
+    static ParseError parseInto(std::string_view text, Container& out) {
+        std::size_t start = 0;
+        std::size_t parsed = 0;
+        while (start <= text.size()) {
+            std::size_t comma = text.find(',', start);
+            if (comma == std::string_view::npos) comma = text.size();
+
+            std::string_view token = trim(text.substr(start, comma - start));
+            if (!token.empty()) {
+                T value{};
+                ParseErrorCode code = parseNumber(token, value);
+                if (code != ParseErrorCode::None) {
+                    return { code, static_cast<std::size_t>(token.data() - text.data()), token };
+                }
+                out.push_back(value);
+                ++parsed;
+            }
+            start = comma + 1;
+        }
+
+        if (parsed == 0) return { ParseErrorCode::NoCoefficients, 0, text };
+        return {};
+    }
+
+    // Sparse lists write a term as coefficient@exponent, so "1@10000, -1" is
+    // x^10000 - 1 in two terms instead of 10001 coefficients.
+    static bool isSparse(std::string_view text) {
+        return text.find('@') != std::string_view::npos;
+    }
+
+    // Whether error points at the exponent of a coefficient@exponent term
+    // rather than at a coefficient; both can be OutOfRange.
+    static bool isExponentError(std::string_view text, const ParseError& error) {
+        std::size_t i = std::min(error.position, text.size());
+        while (i > 0 && isSpace(text[i - 1])) --i;
+        return i > 0 && text[i - 1] == '@';
+    }
+
+    // Appends a SparseTerm per token to out. In a sparse list a bare
+    // coefficient is the constant term; in a list without any '@' it is the
+    // term of its position, so dense lists read the same as parseInto's.
+    // Exponents are non-negative and at most maxExponent.
+    template<typename Container>
+    static ParseError parseTermsInto(std::string_view text, Container& out,
+                                     int maxExponent = std::numeric_limits<int>::max()) {
+        const bool sparse = isSparse(text);
+        std::size_t start = 0;
+        int position = 0;
+        while (start <= text.size()) {
+            std::size_t comma = text.find(',', start);
+            if (comma == std::string_view::npos) comma = text.size();
+
+            std::string_view token = trim(text.substr(start, comma - start));
+            if (!token.empty()) {
+                std::size_t at = token.find('@');
+                std::string_view coefficient = trim(token.substr(0, at));
+                T value{};
+                ParseErrorCode code = parseNumber(coefficient, value);
+                if (code != ParseErrorCode::None) {
+                    return { code, static_cast<std::size_t>(token.data() - text.data()), token };
+                }
+
+                int exponent = sparse ? 0 : position;
+                if (at != std::string_view::npos) {
+                    std::string_view power = trim(token.substr(at + 1));
+                    code = parseExponent(power, maxExponent, exponent);
+                    if (code != ParseErrorCode::None) {
+                        return { code, static_cast<std::size_t>(power.data() - text.data()), power };
+                    }
+                }
+                out.push_back({ exponent, value });
+                ++position;
+            }
+            start = comma + 1;
+        }
+
+        if (position == 0) return { ParseErrorCode::NoCoefficients, 0, text };
+        return {};
+    }
+
+    // Bulk mode: one contiguous buffer for the whole batch. Inputs that fail
+    // contribute an empty range and record their error.
+    static CoefficientBuffer<T> parseMany(std::span<const std::string_view> inputs) {
+        CoefficientBuffer<T> buffer;
+        std::size_t estimate = 0;
+        for (auto input : inputs) estimate += input.size() / 2 + 1;
+        buffer.values.reserve(estimate);
+        buffer.offsets.reserve(inputs.size() + 1);
+        buffer.errors.reserve(inputs.size());
+
+        buffer.offsets.push_back(0);
+        for (auto input : inputs) {
+            ParseError error = parseInto(input, buffer.values);
+            if (error) buffer.values.resize(buffer.offsets.back());
+            buffer.offsets.push_back(buffer.values.size());
+            buffer.errors.push_back(error);
+        }
+        return buffer;
+    }
+
+private:
+    static ParseErrorCode parseExponent(std::string_view token, int maxExponent, int& out) {
+        if (!token.empty() && token.front() == '+') token.remove_prefix(1);
+        if (token.empty() || token.front() == '-') return ParseErrorCode::InvalidExponent;
+
+        const char* last = token.data() + token.size();
+        auto result = std::from_chars(token.data(), last, out);
+        if (result.ec == std::errc::result_out_of_range) return ParseErrorCode::OutOfRange;
+        if (result.ec != std::errc() || result.ptr != last) return ParseErrorCode::InvalidExponent;
+        if (out > maxExponent) return ParseErrorCode::OutOfRange;
+        return ParseErrorCode::None;
+    }
+
+    static std::string_view trim(std::string_view s) {
+        while (!s.empty() && isSpace(s.front())) s.remove_prefix(1);
+        while (!s.empty() && isSpace(s.back())) s.remove_suffix(1);
+        return s;
+    }
+
+    static bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+    }
+};
@@ -0,0 +1,241 @@
+#include "CompanionSolver.h"
+#include <algorithm>
+#include <cmath>
+
+template<typename T>
+static T withSign(T magnitude, T sign) {
+    return sign >= 0 ? std::abs(magnitude) : -std::abs(magnitude);
+}
+
+template<typename T>
+typename CompanionSolver<T>::Matrix CompanionSolver<T>::companion(const std::vector<T>& monic) {
+    // monic holds c_0..c_{n-1} of x^n + c_{n-1} x^{n-1} + ... + c_0.
+    size_t n = monic.size();
+    Matrix a{ n, std::vector<T>(n * n, T(0)) };
+    for (size_t j = 0; j < n; ++j) {
+        a(0, j) = -monic[n - 1 - j];
+    }
+    for (size_t i = 1; i < n; ++i) {
+        a(i, i - 1) = T(1);
+    }
+    return a;
+}
+
+template<typename T>
+void CompanionSolver<T>::balance(Matrix& a) {
+    // Parlett-Reinsch: scale rows/columns by powers of two until their norms match.
+    const T radix = 2;
+    const T radixSq = radix * radix;
+    const size_t n = a.n;
+    bool done = false;
+    while (!done) {
+        done = true;
+        for (size_t i = 0; i < n; ++i) {
+            T r = 0;
+            T c = 0;
+            for (size_t j = 0; j < n; ++j) {
+                if (j == i) continue;
+                c += std::abs(a(j, i));
+                r += std::abs(a(i, j));
+            }
+            if (c == 0 || r == 0) continue;
+
+            T g = r / radix;
+            T f = 1;
+            T s = c + r;
+            while (c < g) {
+                f *= radix;
+                c *= radixSq;
+            }
+            g = r * radix;
+            while (c > g) {
+                f /= radix;
+                c /= radixSq;
+            }
+            if ((c + r) / f < T(0.95) * s) {
+                done = false;
+                g = 1 / f;
+                for (size_t j = 0; j < n; ++j) a(i, j) *= g;
+                for (size_t j = 0; j < n; ++j) a(j, i) *= f;
+            }
+        }
+    }
+}
+
+template<typename T>
+void CompanionSolver<T>::hessenbergQR(Matrix& a, std::vector<Complex>& eigenvalues) {
+    // EISPACK hqr: deflate 1x1 and 2x2 blocks off the bottom of the active
+    // window, with exceptional shifts every 10 iterations on a stuck block.
+    const int n = static_cast<int>(a.n);
+    const int maxIterations = 60;
+    eigenvalues.assign(n, Complex(0));
+
+    T anorm = 0;
+    for (int i = 0; i < n; ++i) {
+        for (int j = std::max(i - 1, 0); j < n; ++j) {
+            anorm += std::abs(a(i, j));
+        }
+    }
+
+    int nn = n - 1;
+    T t = 0;
+    while (nn >= 0) {
+        int its = 0;
+        int l;
+        do {
+            for (l = nn; l >= 1; --l) {
+                T s = std::abs(a(l - 1, l - 1)) + std::abs(a(l, l));
+                if (s == 0) s = anorm;
+                if (T(std::abs(a(l, l - 1)) + s) == s) {
+                    a(l, l - 1) = 0;
+                    break;
+                }
+            }
+
+            T x = a(nn, nn);
+            if (l == nn) {
+                eigenvalues[nn] = Complex(x + t, 0);
+                --nn;
+                continue;
+            }
+
+            T y = a(nn - 1, nn - 1);
+            T w = a(nn, nn - 1) * a(nn - 1, nn);
+            if (l == nn - 1) {
+                T p = T(0.5) * (y - x);
+                T q = p * p + w;
+                T z = std::sqrt(std::abs(q));
+                x += t;
+                if (q >= 0) {
+                    z = p + withSign(z, p);
+                    T lower = z != 0 ? x - w / z : x + z;
+                    eigenvalues[nn - 1] = Complex(x + z, 0);
+                    eigenvalues[nn] = Complex(lower, 0);
+                } else {
+                    eigenvalues[nn - 1] = Complex(x + p, -z);
+                    eigenvalues[nn] = Complex(x + p, z);
+                }
+                nn -= 2;
+                continue;
+            }
+
+            if (its == maxIterations) {
+                throw SolverException("QR iteration did not converge on the companion matrix");
+            }
+            if (its > 0 && its % 10 == 0) {
+                t += x;
+                for (int i = 0; i <= nn; ++i) a(i, i) -= x;
+                T s = std::abs(a(nn, nn - 1)) + std::abs(a(nn - 1, nn - 2));
+                y = x = T(0.75) * s;
+                w = T(-0.4375) * s * s;
+            }
+            ++its;
+
+            int m;
+            T p = 0, q = 0, r = 0, z = 0;
+            for (m = nn - 2; m >= l; --m) {
+                z = a(m, m);
+                r = x - z;
+                T s = y - z;
+                p = (r * s - w) / a(m + 1, m) + a(m, m + 1);
+                q = a(m + 1, m + 1) - z - r - s;
+                r = a(m + 2, m + 1);
+                s = std::abs(p) + std::abs(q) + std::abs(r);
+                p /= s;
+                q /= s;
+                r /= s;
+                if (m == l) break;
+                T u = std::abs(a(m, m - 1)) * (std::abs(q) + std::abs(r));
+                T v = std::abs(p) * (std::abs(a(m - 1, m - 1)) + std::abs(z) + std::abs(a(m + 1, m + 1)));
+                if (T(u + v) == v) break;
+            }
+
+            for (int i = m + 2; i <= nn; ++i) {
+                a(i, i - 2) = 0;
+                if (i != m + 2) a(i, i - 3) = 0;
+            }
+
+            for (int k = m; k <= nn - 1; ++k) {
+                if (k != m) {
+                    p = a(k, k - 1);
+                    q = a(k + 1, k - 1);
+                    r = 0;
+                    if (k != nn - 1) r = a(k + 2, k - 1);
+                    x = std::abs(p) + std::abs(q) + std::abs(r);
+                    if (x != 0) {
+                        p /= x;
+                        q /= x;
+                        r /= x;
+                    }
+                }
+                T s = withSign(std::sqrt(p * p + q * q + r * r), p);
+                if (s == 0) continue;
+
+                if (k == m) {
+                    if (l != m) a(k, k - 1) = -a(k, k - 1);
+                } else {
+                    a(k, k - 1) = -s * x;
+                }
+                p += s;
+                x = p / s;
+                y = q / s;
+                z = r / s;
+                q /= p;
+                r /= p;
+                for (int j = k; j <= nn; ++j) {
+                    p = a(k, j) + q * a(k + 1, j);
+                    if (k != nn - 1) {
+                        p += r * a(k + 2, j);
+                        a(k + 2, j) -= p * z;
+                    }
+                    a(k + 1, j) -= p * y;
+                    a(k, j) -= p * x;
+                }
+                int mmin = nn < k + 3 ? nn : k + 3;
+                for (int i = l; i <= mmin; ++i) {
+                    p = x * a(i, k) + y * a(i, k + 1);
+                    if (k != nn - 1) {
+                        p += z * a(i, k + 2);
+                        a(i, k + 2) -= p * r;
+                    }
+                    a(i, k + 1) -= p * q;
+                    a(i, k) -= p;
+                }
+            }
+        } while (l < nn - 1);
+    }
+}
+
+template<typename T>
+std::vector<typename CompanionSolver<T>::Complex> CompanionSolver<T>::solve(const Polynomial<T>& poly) {
+    auto coeffs = poly.coeffs();
+    size_t high = coeffs.size();
+    while (high > 0 && coeffs[high - 1] == 0) --high;
+    if (high == 0) {
+        throw SolverException("Cannot solve the zero polynomial");
+    }
+
+    size_t zeroRoots = 0;
+    while (zeroRoots + 1 < high && coeffs[zeroRoots] == 0) ++zeroRoots;
+
+    size_t n = high - 1 - zeroRoots;
+    std::vector<Complex> roots;
+    roots.reserve(n + zeroRoots);
+    if (n > 0) {
+        T lead = coeffs[high - 1];
+        std::vector<T> monic(n);
+        for (size_t i = 0; i < n; ++i) {
+            monic[i] = coeffs[zeroRoots + i] / lead;
+        }
+
+        Matrix a = companion(monic);
+        balance(a);
+        hessenbergQR(a, roots);
+    }
+    roots.insert(roots.end(), zeroRoots, Complex(0));
+    return roots;
+}
+
+template class CompanionSolver<float>;
+template class CompanionSolver<double>;
+template class CompanionSolver<long double>;
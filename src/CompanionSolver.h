@@ -0,0 +1,30 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <vector>
+#include "Polynomial.h"
+#include "Exceptions.h"
+
+// Roots as eigenvalues of the balanced companion matrix, found with the
+// Francis double-shift QR iteration. The companion matrix is already upper
+// Hessenberg, so no reduction step is needed. Cost is O(n^3) time and O(n^2)
+// memory, which suits medium degrees (roughly 20-200).
+template<typename T>
+class CompanionSolver {
+public:
+    using Complex = std::complex<T>;
+
+    static std::vector<Complex> solve(const Polynomial<T>& poly);
+
+private:
+    // Row-major n x n matrix.
+    struct Matrix {
+        size_t n;
+        std::vector<T> data;
+        T& operator()(size_t i, size_t j) { return data[i * n + j]; }
+    };
+
+    static Matrix companion(const std::vector<T>& monic);
+    static void balance(Matrix& a);
+    static void hessenbergQR(Matrix& a, std::vector<Complex>& eigenvalues);
+};
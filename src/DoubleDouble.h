@@ -0,0 +1,135 @@
+#pragma once
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include "ErrorFreeTransforms.h"
+
+// Unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi) / 2: about 106
+// bits of significand, so roughly 32 decimal digits, at 5-20x the cost of a
+// double. Exponent range and special values are those of double. Converts
+// implicitly from double so it drops into Polynomial<T> and the Newton path
+// of PolynomialSolver<T>; explicit cast back to double rounds.
+class DoubleDouble {
+public:
+    constexpr DoubleDouble() = default;
+    constexpr DoubleDouble(double x) : hi_(x), lo_(0) {}
+
+    // hi + lo taken as they are; |lo| must be at most half an ulp of hi.
+    static constexpr DoubleDouble fromParts(double hi, double lo) {
+        DoubleDouble r;
+        r.hi_ = hi;
+        r.lo_ = lo;
+        return r;
+    }
+
+    // hi + lo, renormalized.
+    static DoubleDouble fromSum(double a, double b) {
+        double err;
+        double s = twoSum(a, b, err);
+        return fromParts(s, err);
+    }
+
+    constexpr double hi() const { return hi_; }
+    constexpr double lo() const { return lo_; }
+
+    explicit operator double() const { return hi_ + lo_; }
+
+    constexpr DoubleDouble operator-() const { return fromParts(-hi_, -lo_); }
+
+    friend DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b) {
+        double e1, e2;
+        double s = twoSum(a.hi_, b.hi_, e1);
+        double t = twoSum(a.lo_, b.lo_, e2);
+        e1 += t;
+        s = quickTwoSum(s, e1, e1);
+        e1 += e2;
+        return normalized(s, e1);
+    }
+
+    friend DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) { return a + (-b); }
+
+    friend DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b) {
+        double err;
+        double p = twoProduct(a.hi_, b.hi_, err);
+        err += a.hi_ * b.lo_ + a.lo_ * b.hi_;
+        return normalized(p, err);
+    }
+
+    friend DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b) {
+        // Long division: two double quotient digits and a correction.
+        double q1 = a.hi_ / b.hi_;
+        DoubleDouble r = a - b * DoubleDouble(q1);
+        double q2 = r.hi_ / b.hi_;
+        r = r - b * DoubleDouble(q2);
+        double q3 = r.hi_ / b.hi_;
+        return normalized(q1, q2) + DoubleDouble(q3);
+    }
+
+    DoubleDouble& operator+=(const DoubleDouble& b) { return *this = *this + b; }
+    DoubleDouble& operator-=(const DoubleDouble& b) { return *this = *this - b; }
+    DoubleDouble& operator*=(const DoubleDouble& b) { return *this = *this * b; }
+    DoubleDouble& operator/=(const DoubleDouble& b) { return *this = *this / b; }
+
+    friend bool operator==(const DoubleDouble& a, const DoubleDouble& b) { return a.hi_ == b.hi_ && a.lo_ == b.lo_; }
+    friend bool operator!=(const DoubleDouble& a, const DoubleDouble& b) { return !(a == b); }
+    friend bool operator<(const DoubleDouble& a, const DoubleDouble& b) {
+        return a.hi_ < b.hi_ || (a.hi_ == b.hi_ && a.lo_ < b.lo_);
+    }
+    friend bool operator>(const DoubleDouble& a, const DoubleDouble& b) { return b < a; }
+    friend bool operator<=(const DoubleDouble& a, const DoubleDouble& b) { return !(b < a); }
+    friend bool operator>=(const DoubleDouble& a, const DoubleDouble& b) { return !(a < b); }
+
+    // Found by argument-dependent lookup; generic code that wants to accept
+    // DoubleDouble calls these unqualified after `using std::abs;` etc.
+    friend DoubleDouble abs(const DoubleDouble& a) { return a.hi_ < 0 ? -a : a; }
+    friend DoubleDouble fabs(const DoubleDouble& a) { return abs(a); }
+    friend bool isfinite(const DoubleDouble& a) { return std::isfinite(a.hi_); }
+    friend bool isnan(const DoubleDouble& a) { return std::isnan(a.hi_); }
+
+    friend DoubleDouble sqrt(const DoubleDouble& a) {
+        // One Newton step on the double square root doubles its precision.
+        if (a.hi_ <= 0) return DoubleDouble(std::sqrt(a.hi_));
+        double x = std::sqrt(a.hi_);
+        double err;
+        double xx = twoProduct(x, x, err);
+        DoubleDouble residual = a - fromParts(xx, err);
+        return fromSum(x, residual.hi_ / (2 * x));
+    }
+
+    // Prints the leading double; enough for display, not a round trip.
+    friend std::ostream& operator<<(std::ostream& os, const DoubleDouble& a) { return os << a.hi_; }
+
+private:
+    double hi_ = 0;
+    double lo_ = 0;
+
+    static DoubleDouble normalized(double hi, double lo) {
+        double err;
+        double s = quickTwoSum(hi, lo, err);
+        return fromParts(s, err);
+    }
+};
+
+template<>
+class std::numeric_limits<DoubleDouble> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 2 * std::numeric_limits<double>::digits;
+    static constexpr int digits10 = 31;
+    static constexpr int radix = 2;
+
+    static constexpr DoubleDouble epsilon() { return DoubleDouble(0x1p-104); }
+    static constexpr DoubleDouble min() { return DoubleDouble(std::numeric_limits<double>::min() * 0x1p53); }
+    static constexpr DoubleDouble max() {
+        return DoubleDouble::fromParts(std::numeric_limits<double>::max(),
+                                       std::numeric_limits<double>::max() * 0x1p-55);
+    }
+    static constexpr DoubleDouble lowest() { return -max(); }
+    static constexpr DoubleDouble infinity() { return DoubleDouble(std::numeric_limits<double>::infinity()); }
+    static constexpr DoubleDouble quiet_NaN() { return DoubleDouble(std::numeric_limits<double>::quiet_NaN()); }
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include <cmath>
+#include <limits>
+
+// Error-free transformations: each returns the rounded result and stores the
+// exact rounding error, so that result + err equals the exact value. They need
+// strict IEEE evaluation; -ffast-math or /fp:fast folds the error terms to zero.
+
+// a + b for any a, b (Knuth).
+template<typename T>
+inline T twoSum(T a, T b, T& err) {
+    T s = a + b;
+    T bb = s - a;
+    err = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+// a + b when |a| >= |b| or a == 0 (Dekker); three flops fewer than twoSum.
+template<typename T>
+inline T quickTwoSum(T a, T b, T& err) {
+    T s = a + b;
+    err = b - (s - a);
+    return s;
+}
+
+// Whether std::fma compiles to an instruction. Without it the library call
+// emulates FMA in software, and Dekker's splitting is several times faster.
+#if defined(FP_FAST_FMA) || defined(__FMA__) || defined(__AVX2__)
+#define POLYRANK_FAST_FMA 1
+#endif
+
+// a * b, with the error recovered by a single fused multiply-add, or by
+// Dekker's product of halves where FMA is not in hardware.
+template<typename T>
+inline T twoProduct(T a, T b, T& err) {
+    T p = a * b;
+#ifdef POLYRANK_FAST_FMA
+    err = std::fma(a, b, -p);
+#else
+    // Veltkamp split: hi keeps the top half of the significand, exactly.
+    constexpr T splitter = [] {
+        T s = 1;
+        for (int i = 0; i < (std::numeric_limits<T>::digits + 1) / 2; ++i) s *= 2;
+        return s + 1;
+    }();
+    auto split = [&](T v, T& hi, T& lo) {
+        T t = splitter * v;
+        hi = t - (t - v);
+        lo = v - hi;
+    };
+    T ahi, alo, bhi, blo;
+    split(a, ahi, alo);
+    split(b, bhi, blo);
+    err = ((ahi * bhi - p) + ahi * blo + alo * bhi) + alo * blo;
+#endif
+    return p;
+}
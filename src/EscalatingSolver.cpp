@@ -0,0 +1,39 @@
+#include "EscalatingSolver.h"
+#include "PolynomialSolver.h"
+#include "RootSink.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <optional>
+
+template<typename T>
+EscalatedRoots<T> EscalatingSolver<T>::solveNewton(const Polynomial<T>& poly,
+                                                   const EscalationPolicy<T>& policy) {
+    EscalatedRoots<T> result;
+    result.roots = PolynomialSolver<T>::solveNewton(poly, policy.tolerance, policy.maxIterations);
+    result.errorEstimates.reserve(result.roots.size());
+
+    // Built on first use; exact, since every T is representable in Wide.
+    std::optional<Polynomial<Wide>> wide;
+    for (T& root : result.roots) {
+        T estimate = errorEstimate<T>(poly.coeffs(), root);
+        if (estimate > policy.tolerance * std::max(T(1), std::abs(root)) &&
+            relativeResidual<T>(poly.coeffs(), std::complex<T>(root)) <= policy.maxBackwardError) {
+            if (!wide) {
+                std::vector<Wide> coeffs(poly.coeffs().begin(), poly.coeffs().end());
+                wide.emplace(coeffs);
+            }
+            Wide x = PolynomialSolver<Wide>::refineRoot(*wide, Wide(root),
+                                                        Wide(std::numeric_limits<T>::epsilon()),
+                                                        policy.refineIterations);
+            root = static_cast<T>(x);
+            estimate = static_cast<T>(errorEstimate<Wide>(wide->coeffs(), x));
+            ++result.escalated;
+        }
+        result.errorEstimates.push_back(estimate);
+    }
+    return result;
+}
+
+template class EscalatingSolver<float>;
+template class EscalatingSolver<double>;
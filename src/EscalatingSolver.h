@@ -0,0 +1,73 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+#include "Polynomial.h"
+#include "DoubleDouble.h"
+#include "Exceptions.h"
+
+// The next precision up: what a root is re-solved in when T is not enough.
+template<typename T> struct WiderPrecision;
+template<> struct WiderPrecision<float> { using type = double; };
+template<> struct WiderPrecision<double> { using type = DoubleDouble; };
+
+template<typename T>
+struct EscalationPolicy {
+    T tolerance = T(1e-10);      // wanted error bound, relative to max(1, |root|)
+    int maxIterations = 1000;    // Newton in T
+    int refineIterations = 200;  // Newton in the wider type, per escalated root
+    // Only points that are roots to within this backward error are escalated;
+    // beyond it Newton was wandering (typically near a complex pair) and more
+    // precision will not turn the point into a root.
+    T maxBackwardError = std::sqrt(std::numeric_limits<T>::epsilon());
+};
+
+template<typename T>
+struct EscalatedRoots {
+    std::vector<T> roots;           // in the order solveNewton found them
+    std::vector<T> errorEstimates;  // estimated |root - true root|, in step with roots
+    std::size_t escalated = 0;      // roots that needed the wider type
+};
+
+// Newton with per-root precision escalation. Everything is solved in T first;
+// then each root gets an a-posteriori error estimate on the original
+// polynomial, |p(x)| plus the rounding floor of evaluating p in T, over
+// |p'(x)|. Only roots whose estimate misses the tolerance while their backward
+// error is small, the signature of ill-conditioning rather than of a miss,
+// are polished again in the wider type. Well-conditioned inputs never leave
+// T; clustered or Wilkinson-like roots and roots spoiled by deflation get fixed.
+template<typename T>
+class EscalatingSolver {
+public:
+    using Wide = typename WiderPrecision<T>::type;
+
+    static EscalatedRoots<T> solveNewton(const Polynomial<T>& poly,
+                                         const EscalationPolicy<T>& policy = {});
+
+    // Bound on the forward error of x as a root of coeffs when p is evaluated
+    // in U; infinite where p'(x) vanishes.
+    template<typename U>
+    static U errorEstimate(std::span<const U> coeffs, U x) {
+        using std::abs;
+        if (coeffs.size() <= 1) return U(0);
+        
+        // Horner for p and p' alongside the running bound sum |a_i| |x|^i.
+        const std::size_t n = coeffs.size() - 1;
+        const U ax = abs(x);
+        U p = coeffs[n];
+        U dp = 0;
+        U bound = abs(coeffs[n]);
+        for (std::size_t i = n; i-- > 0;) {
+            dp = dp * x + p;
+            p = p * x + coeffs[i];
+            bound = bound * ax + abs(coeffs[i]);
+        }
+        if (dp == 0) return std::numeric_limits<U>::infinity();
+        
+        // Horner's rounding error is at most 2n u sum |a_i| |x|^i (Higham 5.1).
+        const U floor = U(2.0 * static_cast<double>(n)) * std::numeric_limits<U>::epsilon() * bound;
+        return (abs(p) + floor) / abs(dp);
+    }
+};
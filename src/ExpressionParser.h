@@ -0,0 +1,423 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "CoefficientParser.h"
+#include "Exceptions.h"
+#include "Polynomial.h"
+
+// Expressions in x such as "(2x - 1)^3 - x(x + 4)/2", expanded to a
+// Polynomial. The grammar is
+//
+//   sum     = product (('+' | '-') product)*
+//   product = signed (('*' | '/' | juxtaposition) signed)*
+//   signed  = ('+' | '-')* power
+//   power   = primary ('^' digits)?
+//   primary = number | 'x' | '(' sum ')'
+//
+// with juxtaposition only before 'x' or '(' ("2x", "x(x+1)", "(x-1)(x+1)"),
+// and '/' only by a non-zero constant. Numbers go through
+// CoefficientParser<T>::parseNumber, so Polynomial<Rational> expands
+// exactly. Results are canonical: no zero leading coefficients beyond the
+// constant, so two expressions are equal exactly when their coefficients are.
+template<typename T>
+class ExpressionParser {
+public:
+    // Caps the degree of every intermediate result, so "(x+1)^99999" is
+    // rejected before it is expanded.
+    static constexpr int kMaxDegree = 4096;
+    // Caps the estimated size of every intermediate result of an exact type,
+    // its nonzero terms times the bits of its largest coefficient, so neither
+    // "(9^4096)^4096" nor "(2x+1)^4096" sets off multiplications of
+    // megabit numbers. Floating-point coefficients cost the same at any size.
+    static constexpr long long kMaxResultBits = 1 << 18;
+    // Caps how deeply parentheses nest. Each level is a few stack frames
+    // holding polynomials with inline storage (about 6 KB for Rational), so
+    // a long typed answer could otherwise overflow a 1 MB thread stack.
+    static constexpr int kMaxNesting = 32;
+
+    static std::optional<Polynomial<T>> tryParse(std::string_view text, ParseError* error = nullptr) {
+        Cursor cursor{ text, 0, {}, 0 };
+        std::optional<Polynomial<T>> result;
+        if (cursor.skipSpace() == text.size()) {
+            cursor.error = { ParseErrorCode::NoCoefficients, 0, text };
+        } else {
+            result = parseSum(cursor);
+            if (result && cursor.skipSpace() < text.size()) {
+                result = cursor.fail(ParseErrorCode::InvalidExpression, 1);
+            }
+        }
+        if (error) *error = cursor.error;
+        return result;
+    }
+
+    static Polynomial<T> parse(std::string_view text) {
+        ParseError error;
+        auto poly = tryParse(text, &error);
+        if (!poly) {
+            switch (error.code) {
+                case ParseErrorCode::NoCoefficients:
+                    throw InvalidPolynomialException("Empty expression");
+                case ParseErrorCode::InvalidNumber:
+                    throw InvalidPolynomialException("Invalid number: " + std::string(error.token));
+                case ParseErrorCode::OutOfRange:
+                    // A product over the caps has no exponent token to name.
+                    if (error.token.empty()) {
+                        throw InvalidPolynomialException("Expression too large at position " +
+                                                         std::to_string(error.position));
+                    }
+                    [[fallthrough]];
+                case ParseErrorCode::InvalidExponent:
+                    throw InvalidPolynomialException("Invalid exponent: " + std::string(error.token));
+                default:
+                    if (error.token.empty()) throw InvalidPolynomialException("Unexpected end of expression");
+                    throw InvalidPolynomialException("Unexpected '" + std::string(error.token) +
+                                                     "' at position " + std::to_string(error.position));
+            }
+        }
+        return std::move(*poly);
+    }
+
+    // True when text is already expanded: a sum of monomials in distinct
+    // powers of x, without parentheses, each written with at most one
+    // number. "2x+x^2+1/2" is; "x+x", "(x+1)^2", "2*3x", "6/2x" and
+    // "x^2 - -x" are not, whatever they equal.
+    static bool isExpanded(std::string_view text) {
+        if (text.find_first_of("()") != std::string_view::npos) return false;
+        std::vector<int> degrees;
+        std::size_t start = 0;
+        for (std::size_t i = 0; i <= text.size(); ++i) {
+            // A sign right after '^' or another operator belongs to what follows.
+            if (i < text.size() && !((text[i] == '+' || text[i] == '-') && startsTerm(text, i))) continue;
+            std::string_view term = text.substr(start, i - start);
+            start = i;
+            if (term.find_first_not_of(" \t+-") == std::string_view::npos) continue;
+
+            if (!isMonomialText(term)) return false;
+            auto poly = tryParse(term);
+            if (!poly) return false;
+            auto c = poly->coeffs();
+            if (std::count_if(c.begin(), c.end(), [](const T& v) { return v != T(0); }) > 1) return false;
+            degrees.push_back(poly->degree());
+        }
+        std::sort(degrees.begin(), degrees.end());
+        return !degrees.empty() && std::adjacent_find(degrees.begin(), degrees.end()) == degrees.end();
+    }
+
+private:
+    struct Cursor {
+        std::string_view text;
+        std::size_t pos;
+        ParseError error;
+        int depth;  // parentheses open around pos
+
+        std::size_t skipSpace() {
+            while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) ++pos;
+            return pos;
+        }
+
+        char peek() {
+            return skipSpace() < text.size() ? text[pos] : '\0';
+        }
+
+        std::nullopt_t fail(ParseErrorCode code, std::size_t length) {
+            if (!error) error = { code, pos, text.substr(std::min(pos, text.size()), length) };
+            return std::nullopt;
+        }
+    };
+
+    // One term as an expanded answer writes it: an optional sign, then a
+    // number or reduced fraction, x or x^n, or the two with an optional '*'
+    // between; "x/4" divides a bare power. No second number, operator
+    // between constants or second sign.
+    static bool isMonomialText(std::string_view term) {
+        std::size_t i = 0;
+        auto skipSpace = [&] {
+            while (i < term.size() && (term[i] == ' ' || term[i] == '\t')) ++i;
+        };
+        auto at = [&](char c) { return i < term.size() && term[i] == c; };
+        auto digits = [&](std::string_view& out) {
+            const std::size_t start = i;
+            while (i < term.size() && term[i] >= '0' && term[i] <= '9') ++i;
+            out = term.substr(start, i - start);
+            return !out.empty();
+        };
+        // "/d" after a numerator, which must leave the fraction in lowest terms.
+        auto denominator = [&](std::string_view numerator) {
+            ++i;
+            skipSpace();
+            std::string_view d;
+            if (!digits(d)) return false;
+            skipSpace();
+            return isReducedFraction(numerator, d);
+        };
+
+        skipSpace();
+        if (at('+') || at('-')) {
+            ++i;
+            skipSpace();
+        }
+        const std::size_t start = i;
+        while (i < term.size() && ((term[i] >= '0' && term[i] <= '9') || term[i] == '.')) ++i;
+        const std::string_view number = term.substr(start, i - start);
+        skipSpace();
+        if (!number.empty() && at('/')) {
+            if (number.find('.') != std::string_view::npos || !denominator(number)) return false;
+        }
+        const bool star = !number.empty() && at('*');
+        if (star) {
+            ++i;
+            skipSpace();
+        }
+        const bool power = at('x') || at('X');
+        if (power) {
+            ++i;
+            skipSpace();
+            if (at('^')) {
+                ++i;
+                skipSpace();
+                std::string_view exponent;
+                if (!digits(exponent)) return false;
+                skipSpace();
+            }
+            if (number.empty() && at('/') && !denominator("1")) return false;
+        }
+        if (star && !power) return false;
+        return i == term.size() && (power || !number.empty());
+    }
+
+    // numerator/denominator with a denominator above 1 and nothing to cancel.
+    // Parts beyond 64 bits, as in the coefficients of a high power, pass
+    // unchecked: the answer's value is still compared in full.
+    static bool isReducedFraction(std::string_view numerator, std::string_view denominator) {
+        std::uint64_t n = 0;
+        std::uint64_t d = 0;
+        auto parsed = [](std::string_view s, std::uint64_t& out) {
+            auto result = std::from_chars(s.data(), s.data() + s.size(), out);
+            return result.ec == std::errc() && result.ptr == s.data() + s.size();
+        };
+        if (numerator.find_first_not_of('0') == std::string_view::npos ||
+            denominator.find_first_not_of('0') == std::string_view::npos) {
+            return false;
+        }
+        if (!parsed(numerator, n) || !parsed(denominator, d)) return true;
+        return d > 1 && std::gcd(n, d) == 1;
+    }
+
+    // Whether the sign at i separates two terms rather than being part of
+    // an exponent or following another operator.
+    static bool startsTerm(std::string_view text, std::size_t i) {
+        while (i > 0 && (text[i - 1] == ' ' || text[i - 1] == '\t')) --i;
+        return i == 0 || std::string_view("^*/+-").find(text[i - 1]) == std::string_view::npos;
+    }
+
+    static Polynomial<T> canonical(Polynomial<T> p) {
+        auto c = p.coeffs();
+        std::size_t n = c.size();
+        while (n > 1 && c[n - 1] == T(0)) --n;
+        if (n == c.size()) return p;
+        return Polynomial<T>(c.first(n), p.resource());
+    }
+
+    // Terms are added into one buffer, so a long expanded answer costs its
+    // total size rather than a new polynomial per term.
+    static std::optional<Polynomial<T>> parseSum(Cursor& cursor) {
+        auto first = parseProduct(cursor);
+        if (!first) return std::nullopt;
+        std::vector<T> sum(first->coeffs().begin(), first->coeffs().end());
+        for (char op = cursor.peek(); op == '+' || op == '-'; op = cursor.peek()) {
+            ++cursor.pos;
+            auto rhs = parseProduct(cursor);
+            if (!rhs) return std::nullopt;
+            auto c = rhs->coeffs();
+            if (c.size() > sum.size()) sum.resize(c.size(), T(0));
+            for (std::size_t i = 0; i < c.size(); ++i) {
+                if (op == '+') {
+                    sum[i] += c[i];
+                } else {
+                    sum[i] -= c[i];
+                }
+            }
+        }
+        return canonical(Polynomial<T>(sum));
+    }
+
+    static std::optional<Polynomial<T>> parseProduct(Cursor& cursor) {
+        auto result = parseSigned(cursor);
+        while (result) {
+            char op = cursor.peek();
+            if (op == 'x' || op == 'X' || op == '(') {
+                op = '*';
+            } else if (op == '*' || op == '/') {
+                ++cursor.pos;
+            } else {
+                break;
+            }
+            const std::size_t at = cursor.skipSpace();
+            auto rhs = parseSigned(cursor);
+            if (!rhs) return std::nullopt;
+
+            const std::size_t shorter = std::min(result->coeffs().size(), rhs->coeffs().size());
+            const long long bits = coefficientBits(*result) + coefficientBits(*rhs) + bitLength(shorter);
+            const long long terms = std::min<long long>(result->degree() + rhs->degree() + 1,
+                                                        nonzeroTerms(*result) * nonzeroTerms(*rhs));
+            if (bits * terms > kMaxResultBits) {
+                cursor.pos = at;
+                return cursor.fail(ParseErrorCode::OutOfRange, 0);
+            }
+            if (op == '/') {
+                if (rhs->degree() > 0 || rhs->coeffs()[0] == T(0)) {
+                    cursor.pos = at;
+                    return cursor.fail(ParseErrorCode::InvalidExpression, 1);
+                }
+                result = *result * (T(1) / rhs->coeffs()[0]);
+            } else {
+                if (result->degree() + rhs->degree() > kMaxDegree) {
+                    cursor.pos = at;
+                    return cursor.fail(ParseErrorCode::OutOfRange, 0);
+                }
+                if (result->degree() == 0) {
+                    result = canonical(*rhs * result->coeffs()[0]);
+                } else if (rhs->degree() == 0) {
+                    result = canonical(*result * rhs->coeffs()[0]);
+                } else {
+                    result = canonical(*result * *rhs);
+                }
+            }
+        }
+        return result;
+    }
+
+    static std::optional<Polynomial<T>> parseSigned(Cursor& cursor) {
+        bool negative = false;
+        for (char c = cursor.peek(); c == '+' || c == '-'; c = cursor.peek()) {
+            negative ^= c == '-';
+            ++cursor.pos;
+        }
+        auto result = parsePower(cursor);
+        if (result && negative) result = -*result;
+        return result;
+    }
+
+    static std::optional<Polynomial<T>> parsePower(Cursor& cursor) {
+        auto base = parsePrimary(cursor);
+        if (!base || cursor.peek() != '^') return base;
+        ++cursor.pos;
+
+        const std::size_t start = cursor.skipSpace();
+        std::size_t end = start;
+        while (end < cursor.text.size() && cursor.text[end] >= '0' && cursor.text[end] <= '9') ++end;
+        if (end == start) return cursor.fail(ParseErrorCode::InvalidExponent, 1);
+
+        std::string_view digits = cursor.text.substr(start, end - start);
+        int exponent = 0;
+        for (char d : digits) {
+            exponent = exponent * 10 + (d - '0');
+            if (exponent > kMaxDegree) break;
+        }
+        // A monomial, as in every term of an expanded answer, is raised
+        // directly; anything else by repeated squaring, where each power's
+        // coefficients can also gain the bits of a sum over the terms.
+        auto c = base->coeffs();
+        const bool monomial = std::all_of(c.begin(), c.end() - 1, [](const T& v) { return v == T(0); });
+        const long long bits = coefficientBits(*base) + (monomial ? 0 : bitLength(c.size()));
+        const long long terms = monomial ? 1 : exponent * base->degree() + 1;
+        if (exponent > kMaxDegree || exponent * base->degree() > kMaxDegree ||
+            bits * exponent * terms > kMaxResultBits) {
+            return cursor.fail(ParseErrorCode::OutOfRange, digits.size());
+        }
+        cursor.pos = end;
+
+        if (monomial) {
+            std::vector<T> raised(static_cast<std::size_t>(exponent * base->degree()) + 1, T(0));
+            raised.back() = power(c.back(), exponent);
+            return Polynomial<T>(raised);
+        }
+        return canonical(pow(*base, static_cast<unsigned>(exponent)));
+    }
+
+    // Bits in the largest numerator or denominator for exact types with
+    // frexp (BigInteger, Rational); 0 for everything else.
+    static int coefficientBits(const Polynomial<T>& p) {
+        int largest = 0;
+        for (const T& v : p.coeffs()) {
+            int bits = 0;
+            if constexpr (requires { v.numerator(); v.denominator(); }) {
+                int denominatorBits = 0;
+                frexp(v.numerator(), &bits);
+                frexp(v.denominator(), &denominatorBits);
+                bits = std::max(bits, denominatorBits);
+            } else if constexpr (std::numeric_limits<T>::is_exact && !std::is_arithmetic_v<T>) {
+                frexp(v, &bits);
+            }
+            largest = std::max(largest, bits);
+        }
+        return largest;
+    }
+
+    static long long nonzeroTerms(const Polynomial<T>& p) {
+        const auto& c = p.coeffs();
+        return std::count_if(c.begin(), c.end(), [](const T& v) { return v != T(0); });
+    }
+
+    static int bitLength(std::size_t n) {
+        int bits = 0;
+        for (; n; n >>= 1) ++bits;
+        return bits;
+    }
+
+    static T power(T base, int exponent) {
+        T result = T(1);
+        for (; exponent > 0; exponent >>= 1) {
+            if (exponent & 1) result *= base;
+            base *= base;
+        }
+        return result;
+    }
+
+    static std::optional<Polynomial<T>> parsePrimary(Cursor& cursor) {
+        const char c = cursor.peek();
+        if (c == 'x' || c == 'X') {
+            ++cursor.pos;
+            return Polynomial<T>{ T(0), T(1) };
+        }
+        if (c == '(') {
+            if (cursor.depth == kMaxNesting) return cursor.fail(ParseErrorCode::InvalidExpression, 1);
+            ++cursor.pos;
+            ++cursor.depth;
+            auto inner = parseSum(cursor);
+            --cursor.depth;
+            if (!inner) return std::nullopt;
+            if (cursor.peek() != ')') return cursor.fail(ParseErrorCode::InvalidExpression, 1);
+            ++cursor.pos;
+            return inner;
+        }
+        if ((c >= '0' && c <= '9') || c == '.') {
+            const std::size_t start = cursor.pos;
+            std::size_t end = start;
+            while (end < cursor.text.size() && ((cursor.text[end] >= '0' && cursor.text[end] <= '9') ||
+                                                cursor.text[end] == '.')) {
+                ++end;
+            }
+            T value{};
+            std::string_view token = cursor.text.substr(start, end - start);
+            if (CoefficientParser<T>::parseNumber(token, value) != ParseErrorCode::None) {
+                return cursor.fail(ParseErrorCode::InvalidNumber, token.size());
+            }
+            cursor.pos = end;
+            return Polynomial<T>{ value };
+        }
+        if (cursor.pos >= cursor.text.size()) {
+            return cursor.fail(ParseErrorCode::InvalidExpression, 0);
+        }
+        return cursor.fail(ParseErrorCode::InvalidExpression, 1);
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "Polynomial.h"
+#include "PolynomialConcept.h"
+#include "Exceptions.h"
+
+// Degree-N polynomial with inline storage; coefficients are ascending like Polynomial<T>.
+template<typename T, int N>
+class FixedPolynomial {
+    static_assert(N >= 0, "Degree must be non-negative");
+
+public:
+    using value_type = T;
+    using Derivatives = typename Polynomial<T>::Derivatives;
+    static constexpr int kLowerDegree = N > 0 ? N - 1 : 0;
+
+    constexpr FixedPolynomial() : coeffs_{} {}
+
+    constexpr explicit FixedPolynomial(const std::array<T, N + 1>& coeffs) : coeffs_(coeffs) {}
+
+    static FixedPolynomial fromPolynomial(const Polynomial<T>& poly) {
+        if (poly.degree() != N) {
+            throw InvalidPolynomialException("Degree does not match fixed polynomial size");
+        }
+        FixedPolynomial result;
+        for (int i = 0; i <= N; ++i) {
+            result.coeffs_[i] = poly.coeffs()[i];
+        }
+        return result;
+    }
+
+    static constexpr int degree() {
+        return N;
+    }
+
+    constexpr T evaluate(T x) const {
+        return horner(x, std::make_index_sequence<N>{});
+    }
+
+    constexpr Derivatives evaluateDerivatives(T x, bool withSecond = false) const {
+        T p = coeffs_[N];
+        T d1 = 0;
+        T d2 = 0;
+        for (int i = N - 1; i >= 0; --i) {
+            if (withSecond) d2 = d2 * x + d1;
+            d1 = d1 * x + p;
+            p = p * x + coeffs_[i];
+        }
+        return { p, d1, d2 * T(2) };
+    }
+
+    constexpr FixedPolynomial<T, kLowerDegree> derivative() const {
+        std::array<T, kLowerDegree + 1> result{};
+        for (int i = 1; i <= N; ++i) {
+            result[i - 1] = coeffs_[i] * static_cast<T>(i);
+        }
+        return FixedPolynomial<T, kLowerDegree>(result);
+    }
+
+    // Synthetic division by (x - root); the remainder is dropped.
+    constexpr FixedPolynomial<T, kLowerDegree> deflate(T root) const {
+        std::array<T, kLowerDegree + 1> result{};
+        if constexpr (N > 0) {
+            T b = coeffs_[N];
+            result[N - 1] = b;
+            for (int i = N - 1; i >= 1; --i) {
+                b = coeffs_[i] + root * b;
+                result[i - 1] = b;
+            }
+        }
+        return FixedPolynomial<T, kLowerDegree>(result);
+    }
+
+    constexpr const std::array<T, N + 1>& coeffs() const {
+        return coeffs_;
+    }
+
+    Polynomial<T> toPolynomial() const {
+        return Polynomial<T>(std::vector<T>(coeffs_.begin(), coeffs_.end()));
+    }
+
+private:
+    template<std::size_t... I>
+    constexpr T horner(T x, std::index_sequence<I...>) const {
+        T acc = coeffs_[N];
+        ((acc = acc * x + coeffs_[N - 1 - I]), ...);
+        return acc;
+    }
+
+    std::array<T, N + 1> coeffs_;
+};
@@ -4,21 +4,93 @@
 #include <cmath>
 #include <string>
 #include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include "CoefficientParser.h"
 #include "Exceptions.h"
+#include "PolynomialDivider.h"
+#include "PolynomialMultiplier.h"
+#include "PolynomialSimd.h"
+#include "SmallVector.h"
+
+enum class EvaluationMode {
+    // In T's own precision: evaluate() by Estrin's scheme from kEstrinDegree
+    // and a running power sum below it, evaluateMany() by Horner.
+    Plain,
+    // Compensated Horner, about twice T's precision; see evaluate(x, mode)
+    // for what it costs.
+    Compensated
+};
 
 template<typename T>
 class Polynomial {
 public:
+    using value_type = T;
+    // Degrees below 8 never touch the heap.
+    using Storage = SmallVector<T, 8>;
+    
+    struct Derivatives {
+        T value;
+        T first;
+        T second;
+    };
+    
     Polynomial() = default;
     
-    explicit Polynomial(const std::vector<T>& coeffs) : coeffs_(coeffs) {
+    explicit Polynomial(const std::vector<T>& coeffs,
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : Polynomial(std::span<const T>(coeffs), resource) {}
+    
+    Polynomial(std::initializer_list<T> coeffs,
+               std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : Polynomial(std::span<const T>(coeffs.begin(), coeffs.size()), resource) {}
+    
+    explicit Polynomial(std::span<const T> coeffs,
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : coeffs_(coeffs.data(), coeffs.size(), resource) {
         if (coeffs.empty()) {
             throw InvalidPolynomialException("Coefficients cannot be empty");
         }
     }
     
+    explicit Polynomial(Storage&& coeffs) : coeffs_(std::move(coeffs)) {
+        if (coeffs_.empty()) {
+            throw InvalidPolynomialException("Coefficients cannot be empty");
+        }
+    }
+    
+    Polynomial(const Polynomial& other, std::pmr::memory_resource* resource)
+        : coeffs_(other.coeffs_, resource) {}
+    
+    Polynomial(const Polynomial&) = default;
+    Polynomial(Polynomial&&) noexcept = default;
+    Polynomial& operator=(const Polynomial&) = default;
+    Polynomial& operator=(Polynomial&&) = default;
+    
+    // From this degree on evaluate() switches to Estrin's scheme; below it
+    // the extra powers of x cost more than the shorter dependency chain saves
+    // (bench section "estrin").
+    static constexpr int kEstrinDegree = 16;
+    
+    // Exact types (std::numeric_limits<T>::is_exact) use Horner throughout:
+    // with no rounding to shorten, the fewest multiplications win, and the
+    // intermediate values stay the size of the result.
     T evaluate(T x) const {
         if (coeffs_.empty()) return 0;
+        if constexpr (std::numeric_limits<T>::is_exact) {
+            T result = coeffs_[coeffs_.size() - 1];
+            for (size_t i = coeffs_.size() - 1; i-- > 0;) {
+                result *= x;
+                result += coeffs_[i];
+            }
+            return result;
+        }
+        if (degree() >= kEstrinDegree) return estrin(coeffs_.data(), coeffs_.size(), x);
         
         T result = 0;
         T power = 1;
@@ -29,16 +101,100 @@ public:
         return result;
     }
     
+    // Compensated mode is the one to use for residuals and answer keys: near
+    // a root of a high-degree polynomial plain evaluation is mostly rounding.
+    // It applies to the built-in floating types; any other T evaluates plainly.
+    // A single point is one serial chain of error-free transforms, about 12x
+    // plain evaluate() and slower even than Horner in long double; through
+    // evaluateMany() the lanes overlap and it costs about 4x plain
+    // (bench section "compensated").
+    T evaluate(T x, EvaluationMode mode) const {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (mode == EvaluationMode::Compensated && !coeffs_.empty()) {
+                T result = 0;
+                compensatedHornerScalar(coeffs_.data(), coeffs_.size(), &x, &result, 1);
+                return result;
+            }
+        }
+        return evaluate(x);
+    }
+    
+    // Horner across SIMD lanes; out[i] = p(xs[i]). Without lanes to fill
+    // (long double, complex, a machine without AVX2) each point goes by
+    // Estrin from kEstrinDegree, as in evaluate(), since one Horner chain
+    // per point is what the batch was meant to beat.
+    void evaluateMany(std::span<const T> xs, std::span<T> out,
+                      EvaluationMode mode = EvaluationMode::Plain) const {
+        if (out.size() < xs.size()) {
+            throw InvalidPolynomialException("Output span is smaller than input span");
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (mode == EvaluationMode::Compensated) {
+                compensatedHornerMany(coeffs_.data(), coeffs_.size(), xs.data(), out.data(), xs.size());
+                return;
+            }
+        }
+        if constexpr (!std::numeric_limits<T>::is_exact) {
+            if (degree() >= kEstrinDegree && !hasSimdHorner<T>()) {
+                for (size_t i = 0; i < xs.size(); ++i) out[i] = estrin(coeffs_.data(), coeffs_.size(), xs[i]);
+                return;
+            }
+        }
+        hornerMany(coeffs_.data(), coeffs_.size(), xs.data(), out.data(), xs.size());
+    }
+    
+    // p(x), p'(x) and, when asked for, p''(x) from a single Horner pass.
+    // From kEstrinDegree on, floating types use the fused Estrin of
+    // estrinDerivatives() instead: the Horner pass is one long dependency
+    // chain and, like evaluate(), loses to the shorter trees there.
+    Derivatives evaluateDerivatives(T x, bool withSecond = false) const {
+        return evaluateDerivatives(coeffs(), x, withSecond);
+    }
+    
+    static Derivatives evaluateDerivatives(std::span<const T> coeffs, T x, bool withSecond = false) {
+        if (coeffs.empty()) return { T(0), T(0), T(0) };
+        
+        size_t n = coeffs.size() - 1;
+        if constexpr (!std::numeric_limits<T>::is_exact) {
+            if (n >= static_cast<size_t>(kEstrinDegree)) {
+                Derivatives d{ T(0), T(0), T(0) };
+                if (withSecond) {
+                    estrinDerivatives<true>(coeffs.data(), coeffs.size(), x, d.value, d.first, d.second);
+                } else {
+                    estrinDerivatives<false>(coeffs.data(), coeffs.size(), x, d.value, d.first, d.second);
+                }
+                return d;
+            }
+        }
+        T p = coeffs[n];
+        T d1 = 0;
+        T d2 = 0;
+        if (withSecond) {
+            for (size_t i = n; i-- > 0;) {
+                d2 = d2 * x + d1;
+                d1 = d1 * x + p;
+                p = p * x + coeffs[i];
+            }
+        } else {
+            for (size_t i = n; i-- > 0;) {
+                d1 = d1 * x + p;
+                p = p * x + coeffs[i];
+            }
+        }
+        return { p, d1, d2 * T(2) };
+    }
+    
     Polynomial<T> derivative() const {
         if (coeffs_.size() <= 1) {
-            return Polynomial<T>({0});
+            return Polynomial<T>({ T(0) }, coeffs_.resource());
         }
         
-        std::vector<T> derivCoeffs;
+        Storage derivCoeffs(coeffs_.resource());
+        derivCoeffs.resize(coeffs_.size() - 1);
         for (size_t i = 1; i < coeffs_.size(); ++i) {
-            derivCoeffs.push_back(coeffs_[i] * static_cast<T>(i));
+            derivCoeffs[i - 1] = coeffs_[i] * static_cast<T>(i);
         }
-        return Polynomial<T>(derivCoeffs);
+        return Polynomial<T>(std::move(derivCoeffs));
     }
     
     int degree() const {
@@ -61,7 +217,8 @@ public:
                 oss << "-";
             }
             
-            T absCoeff = std::abs(coeff);
+            using std::abs;
+            T absCoeff = abs(coeff);
             
             if (i == 0) {
                 oss << absCoeff;
@@ -76,35 +233,188 @@ public:
             firstTerm = false;
         }
         
+        // All coefficients zero, as after a cancelling difference.
+        if (firstTerm) return "0";
         return oss.str();
     }
     
-    const std::vector<T>& coeffs() const {
-        return coeffs_;
+    std::span<const T> coeffs() const {
+        return std::span<const T>(coeffs_.data(), coeffs_.size());
     }
     
-    static Polynomial<T> parse(const std::string& str) {
-        std::vector<T> coeffs;
-        std::stringstream ss(str);
-        std::string token;
-        
-        while (std::getline(ss, token, ',')) {
-            if (!token.empty()) {
-                try {
-                    coeffs.push_back(static_cast<T>(std::stod(token)));
-                } catch (const std::exception&) {
-                    throw InvalidPolynomialException("Invalid coefficient: " + token);
-                }
+    // Arithmetic keeps the left operand's memory resource. Sums and
+    // differences drop leading coefficients that cancel to exactly zero.
+    friend Polynomial operator+(const Polynomial& a, const Polynomial& b) {
+        return combine(a, b, T(1));
+    }
+    
+    friend Polynomial operator-(const Polynomial& a, const Polynomial& b) {
+        return combine(a, b, T(-1));
+    }
+    
+    Polynomial operator-() const {
+        Storage negated(coeffs_, coeffs_.resource());
+        for (auto& c : negated) c = -c;
+        return Polynomial(std::move(negated));
+    }
+    
+    // Schoolbook, Karatsuba, FFT or exact NTT by size; see PolynomialMultiplier.
+    friend Polynomial operator*(const Polynomial& a, const Polynomial& b) {
+        return multiply(a, b, MultiplyAlgorithm::Auto);
+    }
+    
+    friend Polynomial operator*(const Polynomial& a, T scalar) {
+        Storage scaled(a.coeffs_, a.coeffs_.resource());
+        for (auto& c : scaled) c *= scalar;
+        return Polynomial(std::move(scaled));
+    }
+    
+    friend Polynomial operator*(T scalar, const Polynomial& a) { return a * scalar; }
+    
+    Polynomial& operator+=(const Polynomial& b) { return *this = *this + b; }
+    Polynomial& operator-=(const Polynomial& b) { return *this = *this - b; }
+    Polynomial& operator*=(const Polynomial& b) { return *this = *this * b; }
+    
+    static Polynomial multiply(const Polynomial& a, const Polynomial& b, MultiplyAlgorithm algorithm) {
+        Storage product(a.coeffs_.resource());
+        product.resize(a.coeffs_.size() + b.coeffs_.size() - 1);
+        PolynomialMultiplier<T>::multiply(a.coeffs(), b.coeffs(),
+                                          std::span<T>(product.data(), product.size()), algorithm);
+        return Polynomial(std::move(product));
+    }
+    
+    struct Division;
+    
+    // *this = quotient * divisor + remainder with deg remainder < deg divisor;
+    // long division or Newton inversion by size, see PolynomialDivider.
+    Division divmod(const Polynomial& divisor, DivideAlgorithm algorithm = DivideAlgorithm::Auto) const;
+    
+    friend Polynomial operator/(const Polynomial& a, const Polynomial& b) { return a.divmod(b).quotient; }
+    friend Polynomial operator%(const Polynomial& a, const Polynomial& b) { return a.divmod(b).remainder; }
+    
+    // Monic; remainders below tolerance (relative to a dividend scaled to
+    // max |c| = 1) count as zero, so near-common roots are merged.
+    static Polynomial gcd(const Polynomial& a, const Polynomial& b,
+                          T tolerance = PolynomialDivider<T>::defaultTolerance()) {
+        auto ca = a.coeffs();
+        auto cb = b.coeffs();
+        std::vector<T> g = PolynomialDivider<T>::gcd(std::vector<T>(ca.begin(), ca.end()),
+                                                     std::vector<T>(cb.begin(), cb.end()), tolerance);
+        return Polynomial(std::span<const T>(g), a.coeffs_.resource());
+    }
+    
+    // Zero when a and b have a common root; otherwise lead(a)^deg(b) times
+    // the product of b over the roots of a.
+    static T resultant(const Polynomial& a, const Polynomial& b,
+                       T tolerance = PolynomialDivider<T>::defaultTolerance()) {
+        auto ca = a.coeffs();
+        auto cb = b.coeffs();
+        return PolynomialDivider<T>::resultant(std::vector<T>(ca.begin(), ca.end()),
+                                               std::vector<T>(cb.begin(), cb.end()), tolerance);
+    }
+    
+    // By repeated squaring: about log2(exponent) products.
+    friend Polynomial pow(const Polynomial& base, unsigned exponent) {
+        Polynomial result({ T(1) }, base.coeffs_.resource());
+        Polynomial square(base, base.coeffs_.resource());
+        for (; exponent; exponent >>= 1) {
+            if (exponent & 1) result *= square;
+            if (exponent > 1) square *= square;
+        }
+        return result;
+    }
+    
+    std::pmr::memory_resource* resource() const {
+        return coeffs_.resource();
+    }
+    
+    static Polynomial<T> parse(std::string_view str) {
+        ParseError error;
+        auto poly = tryParse(str, &error);
+        if (!poly) {
+            if (error.code == ParseErrorCode::NoCoefficients) {
+                throw InvalidPolynomialException("No coefficients found");
+            }
+            if (error.code == ParseErrorCode::InvalidExponent) {
+                throw InvalidPolynomialException("Invalid exponent: " + std::string(error.token));
             }
+            if (error.code == ParseErrorCode::OutOfRange && CoefficientParser<T>::isExponentError(str, error)) {
+                throw InvalidPolynomialException("Exponent too large: " + std::string(error.token));
+            }
+            throw InvalidPolynomialException("Invalid coefficient: " + std::string(error.token));
         }
-        
-        if (coeffs.empty()) {
-            throw InvalidPolynomialException("No coefficients found");
+        return std::move(*poly);
+    }
+    
+    // Largest degree parse() expands a sparse list (coefficient@exponent
+    // terms) to; every coefficient up to it is stored.
+    static constexpr int kMaxParsedDegree = 1 << 22;
+    
+    static std::optional<Polynomial<T>> tryParse(std::string_view str, ParseError* error = nullptr) {
+        Storage coeffs;
+        if (CoefficientParser<T>::isSparse(str)) {
+            std::vector<SparseTerm<T>> terms;
+            ParseError result = CoefficientParser<T>::parseTermsInto(str, terms, kMaxParsedDegree);
+            if (error) *error = result;
+            if (result) return std::nullopt;
+            int degree = 0;
+            for (const auto& term : terms) degree = std::max(degree, term.exponent);
+            coeffs.resize(static_cast<size_t>(degree) + 1);
+            for (const auto& term : terms) coeffs[term.exponent] += term.coefficient;
+            // Terms can cancel ("1@5,-1@5") or be zero ("0@7"); the degree is
+            // that of the highest surviving one, as in SparsePolynomial.
+            while (coeffs.size() > 1 && coeffs.back() == T(0)) coeffs.pop_back();
+            return Polynomial<T>(std::move(coeffs));
         }
-        
-        return Polynomial<T>(coeffs);
+        ParseError result = CoefficientParser<T>::parseInto(str, coeffs);
+        if (error) *error = result;
+        if (result) return std::nullopt;
+        return Polynomial<T>(std::move(coeffs));
     }
 
 private:
-    std::vector<T> coeffs_;
-};
\ No newline at end of file
+    Storage coeffs_;
+    
+    static Polynomial combine(const Polynomial& a, const Polynomial& b, T sign) {
+        const size_t n = std::max(a.coeffs_.size(), b.coeffs_.size());
+        Storage sum(a.coeffs_.resource());
+        sum.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            T ai = i < a.coeffs_.size() ? a.coeffs_[i] : T(0);
+            T bi = i < b.coeffs_.size() ? b.coeffs_[i] : T(0);
+            sum[i] = ai + sign * bi;
+        }
+        while (sum.size() > 1 && sum[sum.size() - 1] == T(0)) sum.pop_back();
+        return Polynomial(std::move(sum));
+    }
+};
+
+template<typename T>
+struct Polynomial<T>::Division {
+    Polynomial quotient;
+    Polynomial remainder;
+};
+
+template<typename T>
+typename Polynomial<T>::Division Polynomial<T>::divmod(const Polynomial& divisor, DivideAlgorithm algorithm) const {
+    auto num = coeffs();
+    auto den = divisor.coeffs();
+    while (den.size() > 1 && den.back() == T(0)) den = den.first(den.size() - 1);
+    while (num.size() > 1 && num.back() == T(0)) num = num.first(num.size() - 1);
+    if (den.back() == T(0)) {
+        throw InvalidPolynomialException("Division by the zero polynomial");
+    }
+    if (num.size() < den.size()) {
+        return { Polynomial({ T(0) }, coeffs_.resource()), Polynomial(num, coeffs_.resource()) };
+    }
+    
+    Storage q(coeffs_.resource());
+    Storage r(coeffs_.resource());
+    q.resize(num.size() - den.size() + 1);
+    r.resize(den.size() - 1);
+    PolynomialDivider<T>::divide(num, den, std::span<T>(q.data(), q.size()), std::span<T>(r.data(), r.size()),
+                                 algorithm);
+    while (r.size() > 1 && r[r.size() - 1] == T(0)) r.pop_back();
+    if (r.empty()) r.push_back(T(0));
+    return { Polynomial(std::move(q)), Polynomial(std::move(r)) };
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include <concepts>
+
+// Shared surface of Polynomial<T> and FixedPolynomial<T, N> that the solver relies on.
+template<typename P>
+concept PolynomialLike = requires(const P& p, typename P::value_type x) {
+    { p.degree() } -> std::convertible_to<int>;
+    { p.evaluate(x) } -> std::convertible_to<typename P::value_type>;
+    { p.evaluateDerivatives(x, true).value } -> std::convertible_to<typename P::value_type>;
+    { p.evaluateDerivatives(x, true).first } -> std::convertible_to<typename P::value_type>;
+    { p.evaluateDerivatives(x, true).second } -> std::convertible_to<typename P::value_type>;
+    { p.coeffs()[0] } -> std::convertible_to<typename P::value_type>;
+};
@@ -0,0 +1,266 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+#include "Exceptions.h"
+#include "PolynomialMultiplier.h"
+
+enum class DivideAlgorithm {
+    Auto,       // by size
+    Classical,  // long division, O((n - m) m)
+    Newton      // reversed-series inverse of the divisor, O(M(n)) with M from PolynomialMultiplier
+};
+
+// Division with remainder, GCD and resultant on ascending coefficient arrays.
+// Leading coefficients are taken as they are: callers trim exact zeros, and
+// the GCD and resultant trim remainders against a tolerance of their own.
+//
+// Both division algorithms lose accuracy in proportion to the quotient's
+// coefficients, which grow geometrically for divisors with roots well outside
+// the unit circle. Long division of integer-valued inputs stays exact while
+// every partial remainder fits in the significand; Newton rounds in its
+// products, so Auto keeps integer inputs on long division.
+template<typename T>
+class PolynomialDivider {
+public:
+    // Newton pays for its three products once both the quotient and the
+    // divisor are at least this long (bench section "divide"); with either
+    // one short, long division is a few cheap passes. Complex coefficients
+    // reach the FFT products sooner and cross over sooner with them.
+    static constexpr std::size_t kNewtonThreshold = ComplexParts<T>::isComplex ? 256 : 1024;
+
+    // Zero for exact types, whose remainders cancel exactly.
+    static T defaultTolerance() {
+        if constexpr (std::numeric_limits<T>::is_exact) {
+            return T(0);
+        } else {
+            using std::sqrt;
+            return sqrt(std::numeric_limits<T>::epsilon()) / 16;
+        }
+    }
+
+    // num = q * den + r. q.size() must be num.size() - den.size() + 1 and
+    // r.size() den.size() - 1; num must be at least as long as den.
+    static void divide(std::span<const T> num, std::span<const T> den, std::span<T> q, std::span<T> r,
+                       DivideAlgorithm algorithm = DivideAlgorithm::Auto) {
+        checkSizes(num, den, q, r);
+        if (algorithm == DivideAlgorithm::Auto) {
+            algorithm = std::min(q.size(), den.size()) >= kNewtonThreshold &&
+                                !PolynomialMultiplier<T>::isExactInteger(num, den)
+                            ? DivideAlgorithm::Newton
+                            : DivideAlgorithm::Classical;
+        }
+        if (algorithm == DivideAlgorithm::Newton) {
+            newton(num, den, reversedReciprocal(den, q.size()), q, r);
+        } else {
+            classical(num, den, q, r);
+        }
+    }
+
+    // Newton division with the series from reversedReciprocal(den, n) for
+    // some n >= q.size() supplied, so a divisor used many times is inverted
+    // once. Sizes as for divide().
+    static void divide(std::span<const T> num, std::span<const T> den, std::span<const T> inverse,
+                       std::span<T> q, std::span<T> r) {
+        checkSizes(num, den, q, r);
+        if (inverse.size() < q.size()) {
+            throw InvalidPolynomialException("Reciprocal series is shorter than the quotient");
+        }
+        newton(num, den, inverse, q, r);
+    }
+
+    // 1 / rev(den) mod x^n, with rev reversing the coefficients.
+    static std::vector<T> reversedReciprocal(std::span<const T> den, std::size_t n) {
+        std::vector<T> revDen(den.rbegin(), den.rbegin() + std::min(den.size(), n));
+        return reciprocal(revDen, n);
+    }
+
+    // num mod den, shorter than den (empty when den is a constant).
+    static std::vector<T> remainder(std::span<const T> num, std::span<const T> den) {
+        if (num.size() < den.size()) return std::vector<T>(num.begin(), num.end());
+        std::vector<T> q(num.size() - den.size() + 1);
+        std::vector<T> r(den.size() - 1);
+        divide(num, den, q, r);
+        return r;
+    }
+
+    // num div den; { 0 } when num is the shorter. Exact division in theory
+    // leaves a remainder of pure rounding, which is dropped.
+    static std::vector<T> quotient(std::span<const T> num, std::span<const T> den) {
+        if (num.size() < den.size()) return { T(0) };
+        std::vector<T> q(num.size() - den.size() + 1);
+        std::vector<T> r(den.size() - 1);
+        divide(num, den, q, r);
+        return q;
+    }
+
+    // 1 / f mod x^n by Newton's iteration g <- g (2 - f g), which doubles the
+    // number of correct terms per step. f[0] must be non-zero.
+    static std::vector<T> reciprocal(std::span<const T> f, std::size_t n) {
+        if (f.empty() || f[0] == T(0)) {
+            throw InvalidPolynomialException("Series has no reciprocal");
+        }
+        std::vector<T> g(n);
+        if (n == 0) return g;
+        g[0] = T(1) / f[0];
+
+        std::vector<T> fg, correction;
+        for (std::size_t len = 1; len < n;) {
+            const std::size_t next = std::min(2 * len, n);
+            // f g = 1 mod x^len, so only terms len..next-1 of f g - 1 are
+            // non-zero, and g's new terms are -g times those.
+            const std::size_t fLen = std::min(f.size(), next);
+            fg.resize(fLen + len - 1);
+            PolynomialMultiplier<T>::multiply(f.first(fLen), std::span<const T>(g.data(), len), fg);
+            fg.resize(std::max(fg.size(), next), T(0));
+
+            const std::size_t added = next - len;
+            correction.resize(2 * added - 1);
+            PolynomialMultiplier<T>::multiply(std::span<const T>(g.data(), added),
+                                              std::span<const T>(fg.data() + len, added), correction);
+            for (std::size_t i = 0; i < added; ++i) g[len + i] = -correction[i];
+            len = next;
+        }
+        return g;
+    }
+
+    // Monic GCD by Euclid with both operands rescaled to max |c| = 1 at every
+    // step; remainder coefficients at or below tolerance count as zero. { 1 }
+    // for coprime inputs.
+    static std::vector<T> gcd(std::vector<T> a, std::vector<T> b, T tolerance = defaultTolerance()) {
+        trim(a, tolerance * maxAbs(a));
+        trim(b, tolerance * maxAbs(b));
+        if (a.size() < b.size()) std::swap(a, b);
+        if (a.empty()) {
+            throw InvalidPolynomialException("GCD of two zero polynomials");
+        }
+        if (b.empty()) {
+            makeMonic(a);
+            return a;
+        }
+        normalize(a);
+        normalize(b);
+
+        for (;;) {
+            // A non-zero constant divides everything: the inputs were coprime.
+            if (b.size() == 1) return { T(1) };
+
+            std::vector<T> r = remainder(a, b);
+            // Relative to the dividend, which is normalized to 1.
+            trim(r, tolerance);
+            if (r.empty()) {
+                makeMonic(b);
+                return b;
+            }
+            a = std::move(b);
+            b = std::move(r);
+            normalize(b);
+        }
+    }
+
+    // Res(a, b), the product of b over the roots of a times lead(a)^deg(b),
+    // through the Euclidean recurrence
+    //   Res(a, b) = (-1)^(deg a deg b) lead(b)^(deg a - deg r) Res(b, r)
+    // with r = a mod b. Zero exactly when a and b share a root; remainders
+    // are trimmed as in gcd(), but against the unscaled dividend.
+    static T resultant(std::vector<T> a, std::vector<T> b, T tolerance = defaultTolerance()) {
+        trim(a, T(0));
+        trim(b, T(0));
+        if (a.empty() || b.empty()) return T(0);
+
+        T result = T(1);
+        while (b.size() > 1) {
+            std::vector<T> r = remainder(a, b);
+            trim(r, tolerance * maxAbs(a));
+            if (r.empty()) return T(0);
+
+            const std::size_t da = a.size() - 1;
+            const std::size_t db = b.size() - 1;
+            const std::size_t dr = r.size() - 1;
+            if (da % 2 == 1 && db % 2 == 1) result = -result;
+            result *= power(b.back(), da - dr);
+            a = std::move(b);
+            b = std::move(r);
+        }
+        return result * power(b[0], a.size() - 1);
+    }
+
+private:
+    static void classical(std::span<const T> num, std::span<const T> den, std::span<T> q, std::span<T> r) {
+        std::vector<T> rem(num.begin(), num.end());
+        const std::size_t dn = den.size() - 1;
+        const T lead = den[dn];
+        for (std::size_t shift = q.size(); shift-- > 0;) {
+            const T c = rem[shift + dn] / lead;
+            q[shift] = c;
+            for (std::size_t i = 0; i < dn; ++i) rem[shift + i] -= c * den[i];
+        }
+        std::copy(rem.begin(), rem.begin() + dn, r.begin());
+    }
+
+    static void checkSizes(std::span<const T> num, std::span<const T> den, std::span<T> q, std::span<T> r) {
+        if (den.empty() || den.back() == T(0)) {
+            throw InvalidPolynomialException("Division by the zero polynomial");
+        }
+        if (num.size() < den.size() || q.size() != num.size() - den.size() + 1 || r.size() != den.size() - 1) {
+            throw InvalidPolynomialException("Quotient and remainder sizes do not match the operands");
+        }
+    }
+
+    // rev(q) = rev(num) / rev(den) mod x^(deg num - deg den + 1), where rev
+    // reverses the coefficients; then r = num - q den in the low terms.
+    static void newton(std::span<const T> num, std::span<const T> den, std::span<const T> inverse,
+                       std::span<T> q, std::span<T> r) {
+        const std::size_t k = q.size();
+        std::vector<T> revNum(num.rbegin(), num.rbegin() + k);
+
+        std::vector<T> revQ(2 * k - 1);
+        PolynomialMultiplier<T>::multiply(revNum, inverse.first(k), revQ);
+        std::reverse_copy(revQ.begin(), revQ.begin() + k, q.begin());
+
+        if (r.empty()) return;
+        // Only the low den.size() - 1 terms of q den are needed.
+        const std::size_t dn = r.size();
+        std::span<const T> lowQ(q.data(), std::min(k, dn));
+        std::vector<T> qd(lowQ.size() + dn - 1);
+        PolynomialMultiplier<T>::multiply(lowQ, den.first(dn), qd);
+        for (std::size_t i = 0; i < dn; ++i) r[i] = num[i] - qd[i];
+    }
+
+    static T maxAbs(const std::vector<T>& c) {
+        using std::abs;
+        T scale = T(0);
+        for (const T& v : c) scale = std::max(scale, abs(v));
+        return scale;
+    }
+
+    // Drops leading coefficients at or below bound in magnitude.
+    static void trim(std::vector<T>& c, T bound) {
+        using std::abs;
+        while (!c.empty() && abs(c.back()) <= bound) c.pop_back();
+    }
+
+    static void normalize(std::vector<T>& c) {
+        T scale = maxAbs(c);
+        if (scale > T(0)) {
+            for (T& v : c) v /= scale;
+        }
+    }
+
+    static void makeMonic(std::vector<T>& c) {
+        T lead = c.back();
+        for (T& v : c) v /= lead;
+    }
+
+    static T power(T base, std::size_t exponent) {
+        T result = T(1);
+        for (; exponent; exponent >>= 1) {
+            if (exponent & 1) result *= base;
+            base *= base;
+        }
+        return result;
+    }
+};
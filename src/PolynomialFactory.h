@@ -2,6 +2,7 @@
 #include "Polynomial.h"
 #include "Exceptions.h"
 #include <random>
+#include <span>
 #include <string>
 #include <sstream>
 
@@ -29,7 +30,16 @@ public:
         return Polynomial<T>(coeffs);
     }
     
-    static std::string coefficientsToString(const std::vector<T>& coeffs) {
+    // prod (x - r) as a balanced product tree, so large root sets reach the
+    // fast multiplication tiers instead of n passes of synthetic multiplication.
+    static Polynomial<T> fromRoots(std::span<const T> roots) {
+        if (roots.empty()) return Polynomial<T>({ T(1) });
+        if (roots.size() == 1) return Polynomial<T>({ -roots[0], T(1) });
+        const size_t half = roots.size() / 2;
+        return fromRoots(roots.first(half)) * fromRoots(roots.subspan(half));
+    }
+    
+    static std::string coefficientsToString(std::span<const T> coeffs) {
         std::ostringstream oss;
         for (size_t i = 0; i < coeffs.size(); ++i) {
             if (i > 0) oss << ",";
@@ -39,6 +49,9 @@ public:
     }
     
     static std::vector<T> stringToCoefficients(const std::string& str) {
-        return Polynomial<T>::parse(str).coeffs();
+        // coeffs() is a view, so the polynomial has to outlive the copy.
+        auto poly = Polynomial<T>::parse(str);
+        auto coeffs = poly.coeffs();
+        return std::vector<T>(coeffs.begin(), coeffs.end());
     }
 };
\ No newline at end of file
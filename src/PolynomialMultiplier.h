@@ -0,0 +1,355 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "Exceptions.h"
+
+enum class MultiplyAlgorithm {
+    Auto,        // by size; exact integer products never go through the FFT
+    Schoolbook,  // O(nm)
+    Karatsuba,   // O(n^1.58)
+    Fft,         // O(n log n) in complex floating point; rounds
+    Ntt          // O(n log n) modulo two primes; exact for integer coefficients
+};
+
+template<typename T>
+struct ComplexParts {
+    static constexpr bool isComplex = false;
+    using Real = T;
+};
+
+template<typename T>
+struct ComplexParts<std::complex<T>> {
+    static constexpr bool isComplex = true;
+    using Real = T;
+};
+
+// Products of ascending coefficient arrays. Tiers switch on the length of the
+// shorter operand; the thresholds come from bench section "multiply".
+template<typename T>
+class PolynomialMultiplier {
+public:
+    static constexpr std::size_t kKaratsubaThreshold = 64;
+    // Complex coefficients make every Karatsuba step four real products,
+    // while the transforms cost the same, so their FFT tier starts earlier.
+    static constexpr std::size_t kFftThreshold = ComplexParts<T>::isComplex ? 128 : 512;
+
+    // out.size() must be a.size() + b.size() - 1.
+    static void multiply(std::span<const T> a, std::span<const T> b, std::span<T> out,
+                         MultiplyAlgorithm algorithm = MultiplyAlgorithm::Auto) {
+        if (a.empty() || b.empty() || out.size() != a.size() + b.size() - 1) {
+            throw InvalidPolynomialException("Product needs non-empty operands and a matching output size");
+        }
+        if (algorithm == MultiplyAlgorithm::Auto) algorithm = choose(a, b);
+
+        switch (algorithm) {
+            case MultiplyAlgorithm::Karatsuba:
+                karatsuba(a, b, out);
+                return;
+            case MultiplyAlgorithm::Fft:
+                if constexpr (std::is_floating_point_v<T>) {
+                    fft(a, b, out);
+                    return;
+                } else if constexpr (kComplex) {
+                    fftComplex(a, b, out);
+                    return;
+                }
+                break;
+            case MultiplyAlgorithm::Ntt:
+                if (!isExactInteger(a, b)) {
+                    throw InvalidPolynomialException("NTT needs integer coefficients with an exactly representable product");
+                }
+                if constexpr (std::is_arithmetic_v<T>) {
+                    ntt(a, b, out);
+                    return;
+                }
+                break;
+            default:
+                break;
+        }
+        schoolbook(a.data(), a.size(), b.data(), b.size(), out.data());
+    }
+
+    // All coefficients are integers and every product coefficient, times
+    // headroom, fits in the 53 bits a double holds exactly, which also keeps
+    // it below half the NTT modulus.
+    static bool isExactInteger(std::span<const T> a, std::span<const T> b, double headroom = 1) {
+        if constexpr (!std::is_arithmetic_v<T>) {
+            return false;
+        } else {
+            auto maxIntegral = [](std::span<const T> c) {
+                double largest = 0;
+                for (T v : c) {
+                    if constexpr (std::is_floating_point_v<T>) {
+                        if (!std::isfinite(v) || std::trunc(v) != v) return -1.0;
+                    }
+                    largest = std::max(largest, std::abs(static_cast<double>(v)));
+                }
+                return largest;
+            };
+            double ma = maxIntegral(a);
+            double mb = maxIntegral(b);
+            if (ma < 0 || mb < 0) return false;
+            return ma * mb * static_cast<double>(std::min(a.size(), b.size())) * headroom < 0x1p53;
+        }
+    }
+
+private:
+    static constexpr bool kComplex = ComplexParts<T>::isComplex &&
+                                     std::is_floating_point_v<typename ComplexParts<T>::Real>;
+
+    static MultiplyAlgorithm choose(std::span<const T> a, std::span<const T> b) {
+        std::size_t shorter = std::min(a.size(), b.size());
+        if (shorter < kKaratsubaThreshold) return MultiplyAlgorithm::Schoolbook;
+        if constexpr (kComplex) {
+            if (shorter >= kFftThreshold) return MultiplyAlgorithm::Fft;
+        }
+        if constexpr (std::is_arithmetic_v<T>) {
+            // Exact integer inputs stay exact: NTT from the FFT tier on, and
+            // Karatsuba below it only while its intermediate sums fit too.
+            // Products too long for the NTT primes go to Karatsuba, which
+            // may then round like any floating-point input but never throws.
+            if (isExactInteger(a, b)) {
+                const bool nttFits = nttSize(a.size() + b.size() - 1) <= kMaxNttSize;
+                if (nttFits && (shorter >= kFftThreshold || !isExactInteger(a, b, karatsubaGrowth(shorter)))) {
+                    return MultiplyAlgorithm::Ntt;
+                }
+                return MultiplyAlgorithm::Karatsuba;
+            }
+            if constexpr (std::is_floating_point_v<T>) {
+                if (shorter >= kFftThreshold) return MultiplyAlgorithm::Fft;
+            }
+        }
+        return MultiplyAlgorithm::Karatsuba;
+    }
+
+    // Each Karatsuba level multiplies sums of two halves, so its middle
+    // product's coefficients can be twice the final bound: 2^levels in all.
+    static double karatsubaGrowth(std::size_t n) {
+        double growth = 1;
+        for (; n >= kKaratsubaThreshold; n -= n / 2) growth *= 2;
+        return growth;
+    }
+
+    static void schoolbook(const T* a, std::size_t n, const T* b, std::size_t m, T* out) {
+        std::fill(out, out + n + m - 1, T(0));
+        for (std::size_t i = 0; i < n; ++i) {
+            const T ai = a[i];
+            for (std::size_t j = 0; j < m; ++j) out[i + j] += ai * b[j];
+        }
+    }
+
+    // Two length-n operands into out[0, 2n - 1), by splitting each at h:
+    // (a0 + a1 x^h)(b0 + b1 x^h) with the middle term from one product of sums.
+    static void karatsubaEqual(const T* a, const T* b, std::size_t n, T* out) {
+        if (n < kKaratsubaThreshold) {
+            schoolbook(a, n, b, n, out);
+            return;
+        }
+        const std::size_t h = n / 2;
+        const std::size_t k = n - h;  // high halves, k >= h
+
+        std::vector<T> sumA(a + h, a + n);
+        std::vector<T> sumB(b + h, b + n);
+        for (std::size_t i = 0; i < h; ++i) {
+            sumA[i] += a[i];
+            sumB[i] += b[i];
+        }
+        std::vector<T> middle(2 * k - 1);
+        karatsubaEqual(sumA.data(), sumB.data(), k, middle.data());
+
+        std::fill(out, out + 2 * n - 1, T(0));
+        karatsubaEqual(a, b, h, out);                  // low product in out[0, 2h - 1)
+        karatsubaEqual(a + h, b + h, k, out + 2 * h);  // high product in out[2h, 2n - 1)
+        for (std::size_t i = 0; i + 1 < 2 * h; ++i) middle[i] -= out[i];
+        for (std::size_t i = 0; i + 1 < 2 * k; ++i) middle[i] -= out[2 * h + i];
+        for (std::size_t i = 0; i + 1 < 2 * k; ++i) out[h + i] += middle[i];
+    }
+
+    // Unequal lengths: the longer operand in slices as long as the shorter one.
+    static void karatsuba(std::span<const T> a, std::span<const T> b, std::span<T> out) {
+        if (a.size() < b.size()) std::swap(a, b);
+        const std::size_t m = b.size();
+        std::fill(out.begin(), out.end(), T(0));
+
+        std::vector<T> slice(m);
+        std::vector<T> product(2 * m - 1);
+        for (std::size_t start = 0; start < a.size(); start += m) {
+            const std::size_t len = std::min(m, a.size() - start);
+            std::copy(a.begin() + start, a.begin() + start + len, slice.begin());
+            std::fill(slice.begin() + len, slice.end(), T(0));
+            karatsubaEqual(slice.data(), b.data(), m, product.data());
+            const std::size_t used = std::min(product.size(), out.size() - start);
+            for (std::size_t i = 0; i < used; ++i) out[start + i] += product[i];
+        }
+    }
+
+    // float transforms in double; rounding in float would swamp the product.
+    using Scalar = typename ComplexParts<T>::Real;
+    using Real = std::conditional_t<std::is_same_v<Scalar, float>, double, Scalar>;
+    using Complex = std::complex<Real>;
+
+    static void transform(std::vector<Complex>& data, bool inverse) {
+        const std::size_t n = data.size();
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(data[i], data[j]);
+        }
+        // Twiddles straight from cos/sin rather than by repeated multiplication,
+        // which would accumulate error along each stage.
+        std::vector<Complex> roots(n / 2);
+        const Real angle = (inverse ? 2 : -2) * std::numbers::pi_v<Real> / static_cast<Real>(n);
+        for (std::size_t i = 0; i < n / 2; ++i) {
+            roots[i] = Complex(std::cos(angle * static_cast<Real>(i)), std::sin(angle * static_cast<Real>(i)));
+        }
+        for (std::size_t len = 2; len <= n; len <<= 1) {
+            const std::size_t stride = n / len;
+            for (std::size_t i = 0; i < n; i += len) {
+                for (std::size_t j = 0; j < len / 2; ++j) {
+                    Complex u = data[i + j];
+                    Complex v = data[i + j + len / 2] * roots[j * stride];
+                    data[i + j] = u + v;
+                    data[i + j + len / 2] = u - v;
+                }
+            }
+        }
+    }
+
+    // Both operands ride in one transform as real and imaginary parts; the
+    // product's spectrum is then (F[k]^2 - conj(F[-k])^2) / 4i.
+    static void fft(std::span<const T> a, std::span<const T> b, std::span<T> out) {
+        std::size_t n = 1;
+        while (n < out.size()) n <<= 1;
+        std::vector<Complex> f(n);
+        for (std::size_t i = 0; i < a.size(); ++i) f[i].real(static_cast<Real>(a[i]));
+        for (std::size_t i = 0; i < b.size(); ++i) f[i].imag(static_cast<Real>(b[i]));
+        transform(f, false);
+
+        std::vector<Complex> product(n);
+        const Complex overFourI(0, Real(-0.25));
+        for (std::size_t k = 0; k < n; ++k) {
+            Complex g = std::conj(f[(n - k) & (n - 1)]);
+            product[k] = (f[k] * f[k] - g * g) * overFourI;
+        }
+        transform(product, true);
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = static_cast<T>(product[i].real() / static_cast<Real>(n));
+        }
+    }
+
+    // Complex coefficients take one transform each; no packing trick applies.
+    static void fftComplex(std::span<const T> a, std::span<const T> b, std::span<T> out) {
+        std::size_t n = 1;
+        while (n < out.size()) n <<= 1;
+        std::vector<Complex> fa(n), fb(n);
+        for (std::size_t i = 0; i < a.size(); ++i) fa[i] = Complex(a[i]);
+        for (std::size_t i = 0; i < b.size(); ++i) fb[i] = Complex(b[i]);
+        transform(fa, false);
+        transform(fb, false);
+        for (std::size_t k = 0; k < n; ++k) fa[k] *= fb[k];
+        transform(fa, true);
+        for (std::size_t i = 0; i < out.size(); ++i) out[i] = T(fa[i] / static_cast<Real>(n));
+    }
+
+    // NTT-friendly primes c * 2^k + 1 with primitive root 3; their product
+    // (about 4.7e17) leaves room for the signed 53-bit results.
+    static constexpr std::uint64_t kPrime1 = 998244353;  // 119 * 2^23 + 1
+    static constexpr std::uint64_t kPrime2 = 469762049;  // 7 * 2^26 + 1
+    static constexpr std::size_t kMaxNttSize = std::size_t(1) << 23;
+
+    // Transform length for a product of the given length: the next power of two.
+    static std::size_t nttSize(std::size_t length) {
+        std::size_t n = 1;
+        while (n < length) n <<= 1;
+        return n;
+    }
+
+    static std::uint64_t powMod(std::uint64_t base, std::uint64_t exp, std::uint64_t mod) {
+        std::uint64_t result = 1;
+        base %= mod;
+        for (; exp; exp >>= 1) {
+            if (exp & 1) result = result * base % mod;
+            base = base * base % mod;
+        }
+        return result;
+    }
+
+    // The modulus is a template argument so every % compiles to a multiply
+    // by a constant reciprocal instead of a hardware divide.
+    template<std::uint64_t Mod>
+    static void transformMod(std::vector<std::uint64_t>& data, bool inverse) {
+        const std::size_t n = data.size();
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(data[i], data[j]);
+        }
+        // Powers of one primitive n-th root; stage len takes every (n/len)-th.
+        std::uint64_t root = powMod(3, (Mod - 1) / n, Mod);
+        if (inverse) root = powMod(root, Mod - 2, Mod);
+        std::vector<std::uint64_t> twiddles(n / 2 > 0 ? n / 2 : 1);
+        twiddles[0] = 1;
+        for (std::size_t j = 1; j < n / 2; ++j) twiddles[j] = twiddles[j - 1] * root % Mod;
+        for (std::size_t len = 2; len <= n; len <<= 1) {
+            const std::size_t stride = n / len;
+            for (std::size_t i = 0; i < n; i += len) {
+                for (std::size_t j = 0; j < len / 2; ++j) {
+                    std::uint64_t u = data[i + j];
+                    std::uint64_t v = data[i + j + len / 2] * twiddles[j * stride] % Mod;
+                    data[i + j] = u + v < Mod ? u + v : u + v - Mod;
+                    data[i + j + len / 2] = u >= v ? u - v : u + Mod - v;
+                }
+            }
+        }
+        if (inverse) {
+            const std::uint64_t scale = powMod(n, Mod - 2, Mod);
+            for (auto& v : data) v = v * scale % Mod;
+        }
+    }
+
+    template<std::uint64_t Mod>
+    static std::vector<std::uint64_t> convolveMod(std::span<const T> a, std::span<const T> b, std::size_t n) {
+        auto load = [&](std::span<const T> c) {
+            std::vector<std::uint64_t> v(n, 0);
+            for (std::size_t i = 0; i < c.size(); ++i) {
+                auto x = static_cast<std::int64_t>(c[i]) % static_cast<std::int64_t>(Mod);
+                v[i] = static_cast<std::uint64_t>(x < 0 ? x + static_cast<std::int64_t>(Mod) : x);
+            }
+            return v;
+        };
+        auto fa = load(a);
+        auto fb = load(b);
+        transformMod<Mod>(fa, false);
+        transformMod<Mod>(fb, false);
+        for (std::size_t i = 0; i < n; ++i) fa[i] = fa[i] * fb[i] % Mod;
+        transformMod<Mod>(fa, true);
+        return fa;
+    }
+
+    // Convolution modulo both primes, recombined by CRT and re-centred.
+    static void ntt(std::span<const T> a, std::span<const T> b, std::span<T> out) {
+        const std::size_t n = nttSize(out.size());
+        if (n > kMaxNttSize) {
+            throw InvalidPolynomialException("Product too long for the NTT primes");
+        }
+        auto r1 = convolveMod<kPrime1>(a, b, n);
+        auto r2 = convolveMod<kPrime2>(a, b, n);
+
+        const std::uint64_t inv1 = powMod(kPrime1 % kPrime2, kPrime2 - 2, kPrime2);
+        const std::uint64_t modulus = kPrime1 * kPrime2;
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            std::uint64_t diff = (r2[i] + kPrime2 - r1[i] % kPrime2) % kPrime2;
+            std::uint64_t x = r1[i] + kPrime1 * (diff * inv1 % kPrime2);
+            out[i] = x > modulus / 2 ? -static_cast<T>(modulus - x) : static_cast<T>(x);
+        }
+    }
+};
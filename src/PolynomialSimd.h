@@ -0,0 +1,521 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include "ErrorFreeTransforms.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define POLYRANK_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(POLYRANK_X86) && (defined(__GNUC__) || defined(__clang__))
+#define POLYRANK_TARGET(isa) __attribute__((target(isa)))
+#else
+#define POLYRANK_TARGET(isa)
+#endif
+
+enum class SimdLevel {
+    Scalar,
+    Avx2,
+    Avx512
+};
+
+// Picked once per process; every batched kernel dispatches on this.
+inline SimdLevel detectSimdLevel() {
+    static const SimdLevel level = [] {
+#if defined(POLYRANK_X86) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SimdLevel::Avx512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::Avx2;
+#elif defined(POLYRANK_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool fma = (info[2] & (1 << 12)) != 0;
+        if (!osxsave) return SimdLevel::Scalar;
+        unsigned long long xcr0 = _xgetbv(0);
+        __cpuidex(info, 7, 0);
+        bool avx2 = (info[1] & (1 << 5)) != 0;
+        bool avx512 = (info[1] & (1 << 16)) != 0;
+        if (avx512 && (xcr0 & 0xE6) == 0xE6) return SimdLevel::Avx512;
+        if (avx2 && fma && (xcr0 & 0x6) == 0x6) return SimdLevel::Avx2;
+#endif
+        return SimdLevel::Scalar;
+    }();
+    return level;
+}
+
+// Horner over ascending coefficients, one x per lane.
+template<typename T>
+inline void hornerScalar(const T* coeffs, std::size_t size,
+                         const T* xs, T* out, std::size_t count) {
+    for (std::size_t j = 0; j < count; ++j) {
+        T x = xs[j];
+        T acc = coeffs[size - 1];
+        for (std::size_t i = size - 1; i-- > 0;) {
+            acc = acc * x + coeffs[i];
+        }
+        out[j] = acc;
+    }
+}
+
+// Whether hornerMany spreads T across SIMD lanes on this machine.
+template<typename T>
+inline bool hasSimdHorner() {
+#ifdef POLYRANK_X86
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+        return detectSimdLevel() != SimdLevel::Scalar;
+    }
+#endif
+    return false;
+}
+
+// Estrin's scheme on eight coefficients, c(at) to c(at + 7): depth three
+// instead of seven. c is a callable so derivatives can weight coefficients
+// as they are read.
+template<typename T, typename Coefficient>
+inline T estrin8(const Coefficient& c, std::size_t at, T x, T x2, T x4) {
+    T q0 = c(at) + c(at + 1) * x;
+    T q1 = c(at + 2) + c(at + 3) * x;
+    T q2 = c(at + 4) + c(at + 5) * x;
+    T q3 = c(at + 6) + c(at + 7) * x;
+    return (q0 + q1 * x2) + (q2 + q3 * x2) * x4;
+}
+
+// Estrin subtrees of sixteen coefficients, from x, x^2, x^4, x^8 and x^16
+// computed up front, chained by Horner in x^16. No block depends on the
+// running sum, so the blocks' multiply-adds overlap in the pipeline and only
+// one step in sixteen waits on the previous one; plain Horner waits on every
+// step. Fully recursive Estrin measured slower here: its tree of calls costs
+// more than the shorter chain saves.
+template<typename T>
+inline T estrin(const T* coeffs, std::size_t size, T x) {
+    if (size == 0) return T(0);
+    const T x2 = x * x;
+    const T x4 = x2 * x2;
+    const T x8 = x4 * x4;
+    const T x16 = x8 * x8;
+    const std::size_t blocks = size / 16;
+
+    // The partial block on top goes by Horner and seeds the chain.
+    T acc = 0;
+    if (std::size_t rest = size % 16) {
+        const T* top = coeffs + blocks * 16;
+        acc = top[rest - 1];
+        for (std::size_t i = rest - 1; i-- > 0;) acc = acc * x + top[i];
+    }
+    for (std::size_t b = blocks; b-- > 0;) {
+        auto c = [q = coeffs + b * 16](std::size_t k) { return q[k]; };
+        acc = acc * x16 + (estrin8(c, 0, x, x2, x4) + estrin8(c, 8, x, x2, x4) * x8);
+    }
+    return acc;
+}
+
+// p, p' and, when WithSecond, p'' by the same blocks as estrin(). Each block
+// B(x) and its derivatives are independent Estrin trees; the derivative
+// trees weight the block's coefficients by constants, so nothing converts
+// an index to T. The chain in X = x^16 then carries the product rule:
+// (aX + B)' = a'X + aX' + B' and (aX + B)'' = a''X + 2a'X' + aX'' + B''.
+template<bool WithSecond, typename T>
+inline void estrinDerivatives(const T* coeffs, std::size_t size, T x, T& p, T& d1, T& d2) {
+    const T x2 = x * x;
+    const T x4 = x2 * x2;
+    const T x8 = x4 * x4;
+    const T x16 = x8 * x8;
+    const T x14 = x8 * x4 * x2;
+    const T dx16 = T(16) * x14 * x;
+    const T ddx16 = T(240) * x14;
+    const std::size_t blocks = size / 16;
+
+    // The partial block on top goes by fused Horner and seeds the chains.
+    T a0 = 0;
+    T a1 = 0;
+    T a2 = 0;
+    if (std::size_t rest = size % 16) {
+        const T* top = coeffs + blocks * 16;
+        a0 = top[rest - 1];
+        for (std::size_t i = rest - 1; i-- > 0;) {
+            if constexpr (WithSecond) a2 = a2 * x + T(2) * a1;
+            a1 = a1 * x + a0;
+            a0 = a0 * x + top[i];
+        }
+    }
+    for (std::size_t b = blocks; b-- > 0;) {
+        const T* q = coeffs + b * 16;
+        auto c0 = [q](std::size_t k) { return q[k]; };
+        auto c1 = [q](std::size_t k) { return k < 15 ? q[k + 1] * T(static_cast<int>(k + 1)) : T(0); };
+        const T b0 = estrin8(c0, 0, x, x2, x4) + estrin8(c0, 8, x, x2, x4) * x8;
+        const T b1 = estrin8(c1, 0, x, x2, x4) + estrin8(c1, 8, x, x2, x4) * x8;
+        if constexpr (WithSecond) {
+            auto c2 = [q](std::size_t k) {
+                return k < 14 ? q[k + 2] * T(static_cast<int>((k + 1) * (k + 2))) : T(0);
+            };
+            const T b2 = estrin8(c2, 0, x, x2, x4) + estrin8(c2, 8, x, x2, x4) * x8;
+            a2 = a2 * x16 + T(2) * a1 * dx16 + a0 * ddx16 + b2;
+        }
+        a1 = a1 * x16 + a0 * dx16 + b1;
+        a0 = a0 * x16 + b0;
+    }
+    p = a0;
+    d1 = a1;
+    d2 = a2;
+}
+
+// Compensated Horner (Graillat, Langlois, Louvet): the rounding error of
+// every product and sum is captured exactly and run through a second Horner
+// pass, so the result is as accurate as plain Horner in twice the working
+// precision, then rounded. Every step waits on the last one's error-free
+// transforms, so a lone point costs an order of magnitude more than plain
+// Horner; the vector versions below hide most of that latency.
+template<typename T>
+inline void compensatedHornerScalar(const T* coeffs, std::size_t size,
+                                    const T* xs, T* out, std::size_t count) {
+    for (std::size_t j = 0; j < count; ++j) {
+        T x = xs[j];
+        T acc = coeffs[size - 1];
+        T comp = 0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            T productErr, sumErr;
+            T product = twoProduct(acc, x, productErr);
+            acc = twoSum(product, coeffs[i], sumErr);
+            comp = comp * x + (productErr + sumErr);
+        }
+        out[j] = acc + comp;
+    }
+}
+
+#ifdef POLYRANK_X86
+// Two independent vectors per step so consecutive FMAs do not wait on each other.
+POLYRANK_TARGET("avx2,fma")
+inline void hornerAvx2(const double* coeffs, std::size_t size,
+                       const double* xs, double* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 8 <= count; j += 8) {
+        __m256d x0 = _mm256_loadu_pd(xs + j);
+        __m256d x1 = _mm256_loadu_pd(xs + j + 4);
+        __m256d a0 = _mm256_set1_pd(coeffs[size - 1]);
+        __m256d a1 = a0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m256d c = _mm256_set1_pd(coeffs[i]);
+            a0 = _mm256_fmadd_pd(a0, x0, c);
+            a1 = _mm256_fmadd_pd(a1, x1, c);
+        }
+        _mm256_storeu_pd(out + j, a0);
+        _mm256_storeu_pd(out + j + 4, a1);
+    }
+    for (; j + 4 <= count; j += 4) {
+        __m256d x0 = _mm256_loadu_pd(xs + j);
+        __m256d a0 = _mm256_set1_pd(coeffs[size - 1]);
+        for (std::size_t i = size - 1; i-- > 0;) {
+            a0 = _mm256_fmadd_pd(a0, x0, _mm256_set1_pd(coeffs[i]));
+        }
+        _mm256_storeu_pd(out + j, a0);
+    }
+    hornerScalar(coeffs, size, xs + j, out + j, count - j);
+}
+
+POLYRANK_TARGET("avx2,fma")
+inline void hornerAvx2(const float* coeffs, std::size_t size,
+                       const float* xs, float* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 16 <= count; j += 16) {
+        __m256 x0 = _mm256_loadu_ps(xs + j);
+        __m256 x1 = _mm256_loadu_ps(xs + j + 8);
+        __m256 a0 = _mm256_set1_ps(coeffs[size - 1]);
+        __m256 a1 = a0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m256 c = _mm256_set1_ps(coeffs[i]);
+            a0 = _mm256_fmadd_ps(a0, x0, c);
+            a1 = _mm256_fmadd_ps(a1, x1, c);
+        }
+        _mm256_storeu_ps(out + j, a0);
+        _mm256_storeu_ps(out + j + 8, a1);
+    }
+    for (; j + 8 <= count; j += 8) {
+        __m256 x0 = _mm256_loadu_ps(xs + j);
+        __m256 a0 = _mm256_set1_ps(coeffs[size - 1]);
+        for (std::size_t i = size - 1; i-- > 0;) {
+            a0 = _mm256_fmadd_ps(a0, x0, _mm256_set1_ps(coeffs[i]));
+        }
+        _mm256_storeu_ps(out + j, a0);
+    }
+    hornerScalar(coeffs, size, xs + j, out + j, count - j);
+}
+
+POLYRANK_TARGET("avx512f")
+inline void hornerAvx512(const double* coeffs, std::size_t size,
+                         const double* xs, double* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 16 <= count; j += 16) {
+        __m512d x0 = _mm512_loadu_pd(xs + j);
+        __m512d x1 = _mm512_loadu_pd(xs + j + 8);
+        __m512d a0 = _mm512_set1_pd(coeffs[size - 1]);
+        __m512d a1 = a0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m512d c = _mm512_set1_pd(coeffs[i]);
+            a0 = _mm512_fmadd_pd(a0, x0, c);
+            a1 = _mm512_fmadd_pd(a1, x1, c);
+        }
+        _mm512_storeu_pd(out + j, a0);
+        _mm512_storeu_pd(out + j + 8, a1);
+    }
+    for (; j < count; j += 8) {
+        std::size_t lanes = count - j < 8 ? count - j : 8;
+        __mmask8 mask = static_cast<__mmask8>((1u << lanes) - 1);
+        __m512d x0 = _mm512_maskz_loadu_pd(mask, xs + j);
+        __m512d a0 = _mm512_set1_pd(coeffs[size - 1]);
+        for (std::size_t i = size - 1; i-- > 0;) {
+            a0 = _mm512_fmadd_pd(a0, x0, _mm512_set1_pd(coeffs[i]));
+        }
+        _mm512_mask_storeu_pd(out + j, mask, a0);
+    }
+}
+
+POLYRANK_TARGET("avx512f")
+inline void hornerAvx512(const float* coeffs, std::size_t size,
+                         const float* xs, float* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 32 <= count; j += 32) {
+        __m512 x0 = _mm512_loadu_ps(xs + j);
+        __m512 x1 = _mm512_loadu_ps(xs + j + 16);
+        __m512 a0 = _mm512_set1_ps(coeffs[size - 1]);
+        __m512 a1 = a0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m512 c = _mm512_set1_ps(coeffs[i]);
+            a0 = _mm512_fmadd_ps(a0, x0, c);
+            a1 = _mm512_fmadd_ps(a1, x1, c);
+        }
+        _mm512_storeu_ps(out + j, a0);
+        _mm512_storeu_ps(out + j + 16, a1);
+    }
+    for (; j < count; j += 16) {
+        std::size_t lanes = count - j < 16 ? count - j : 16;
+        __mmask16 mask = static_cast<__mmask16>((1u << lanes) - 1);
+        __m512 x0 = _mm512_maskz_loadu_ps(mask, xs + j);
+        __m512 a0 = _mm512_set1_ps(coeffs[size - 1]);
+        for (std::size_t i = size - 1; i-- > 0;) {
+            a0 = _mm512_fmadd_ps(a0, x0, _mm512_set1_ps(coeffs[i]));
+        }
+        _mm512_mask_storeu_ps(out + j, mask, a0);
+    }
+}
+
+// One compensated Horner step per lane: twoProduct is a single FMA against
+// the rounded product and twoSum six adds, so the step vectorizes as is.
+POLYRANK_TARGET("avx2,fma")
+inline void compensatedStep(__m256d& acc, __m256d& comp, __m256d x, __m256d c) {
+    __m256d product = _mm256_mul_pd(acc, x);
+    __m256d productErr = _mm256_fmsub_pd(acc, x, product);
+    acc = _mm256_add_pd(product, c);
+    __m256d bb = _mm256_sub_pd(acc, product);
+    __m256d sumErr = _mm256_add_pd(_mm256_sub_pd(product, _mm256_sub_pd(acc, bb)), _mm256_sub_pd(c, bb));
+    comp = _mm256_fmadd_pd(comp, x, _mm256_add_pd(productErr, sumErr));
+}
+
+POLYRANK_TARGET("avx2,fma")
+inline void compensatedStep(__m256& acc, __m256& comp, __m256 x, __m256 c) {
+    __m256 product = _mm256_mul_ps(acc, x);
+    __m256 productErr = _mm256_fmsub_ps(acc, x, product);
+    acc = _mm256_add_ps(product, c);
+    __m256 bb = _mm256_sub_ps(acc, product);
+    __m256 sumErr = _mm256_add_ps(_mm256_sub_ps(product, _mm256_sub_ps(acc, bb)), _mm256_sub_ps(c, bb));
+    comp = _mm256_fmadd_ps(comp, x, _mm256_add_ps(productErr, sumErr));
+}
+
+POLYRANK_TARGET("avx512f")
+inline void compensatedStep(__m512d& acc, __m512d& comp, __m512d x, __m512d c) {
+    __m512d product = _mm512_mul_pd(acc, x);
+    __m512d productErr = _mm512_fmsub_pd(acc, x, product);
+    acc = _mm512_add_pd(product, c);
+    __m512d bb = _mm512_sub_pd(acc, product);
+    __m512d sumErr = _mm512_add_pd(_mm512_sub_pd(product, _mm512_sub_pd(acc, bb)), _mm512_sub_pd(c, bb));
+    comp = _mm512_fmadd_pd(comp, x, _mm512_add_pd(productErr, sumErr));
+}
+
+POLYRANK_TARGET("avx512f")
+inline void compensatedStep(__m512& acc, __m512& comp, __m512 x, __m512 c) {
+    __m512 product = _mm512_mul_ps(acc, x);
+    __m512 productErr = _mm512_fmsub_ps(acc, x, product);
+    acc = _mm512_add_ps(product, c);
+    __m512 bb = _mm512_sub_ps(acc, product);
+    __m512 sumErr = _mm512_add_ps(_mm512_sub_ps(product, _mm512_sub_ps(acc, bb)), _mm512_sub_ps(c, bb));
+    comp = _mm512_fmadd_ps(comp, x, _mm512_add_ps(productErr, sumErr));
+}
+
+POLYRANK_TARGET("avx2,fma")
+inline void compensatedHornerAvx2(const double* coeffs, std::size_t size,
+                                  const double* xs, double* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 8 <= count; j += 8) {
+        __m256d x0 = _mm256_loadu_pd(xs + j);
+        __m256d x1 = _mm256_loadu_pd(xs + j + 4);
+        __m256d a0 = _mm256_set1_pd(coeffs[size - 1]);
+        __m256d a1 = a0;
+        __m256d c0 = _mm256_setzero_pd();
+        __m256d c1 = c0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m256d c = _mm256_set1_pd(coeffs[i]);
+            compensatedStep(a0, c0, x0, c);
+            compensatedStep(a1, c1, x1, c);
+        }
+        _mm256_storeu_pd(out + j, _mm256_add_pd(a0, c0));
+        _mm256_storeu_pd(out + j + 4, _mm256_add_pd(a1, c1));
+    }
+    for (; j + 4 <= count; j += 4) {
+        __m256d x0 = _mm256_loadu_pd(xs + j);
+        __m256d a0 = _mm256_set1_pd(coeffs[size - 1]);
+        __m256d c0 = _mm256_setzero_pd();
+        for (std::size_t i = size - 1; i-- > 0;) {
+            compensatedStep(a0, c0, x0, _mm256_set1_pd(coeffs[i]));
+        }
+        _mm256_storeu_pd(out + j, _mm256_add_pd(a0, c0));
+    }
+    compensatedHornerScalar(coeffs, size, xs + j, out + j, count - j);
+}
+
+POLYRANK_TARGET("avx2,fma")
+inline void compensatedHornerAvx2(const float* coeffs, std::size_t size,
+                                  const float* xs, float* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 16 <= count; j += 16) {
+        __m256 x0 = _mm256_loadu_ps(xs + j);
+        __m256 x1 = _mm256_loadu_ps(xs + j + 8);
+        __m256 a0 = _mm256_set1_ps(coeffs[size - 1]);
+        __m256 a1 = a0;
+        __m256 c0 = _mm256_setzero_ps();
+        __m256 c1 = c0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m256 c = _mm256_set1_ps(coeffs[i]);
+            compensatedStep(a0, c0, x0, c);
+            compensatedStep(a1, c1, x1, c);
+        }
+        _mm256_storeu_ps(out + j, _mm256_add_ps(a0, c0));
+        _mm256_storeu_ps(out + j + 8, _mm256_add_ps(a1, c1));
+    }
+    for (; j + 8 <= count; j += 8) {
+        __m256 x0 = _mm256_loadu_ps(xs + j);
+        __m256 a0 = _mm256_set1_ps(coeffs[size - 1]);
+        __m256 c0 = _mm256_setzero_ps();
+        for (std::size_t i = size - 1; i-- > 0;) {
+            compensatedStep(a0, c0, x0, _mm256_set1_ps(coeffs[i]));
+        }
+        _mm256_storeu_ps(out + j, _mm256_add_ps(a0, c0));
+    }
+    compensatedHornerScalar(coeffs, size, xs + j, out + j, count - j);
+}
+
+POLYRANK_TARGET("avx512f")
+inline void compensatedHornerAvx512(const double* coeffs, std::size_t size,
+                                    const double* xs, double* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 16 <= count; j += 16) {
+        __m512d x0 = _mm512_loadu_pd(xs + j);
+        __m512d x1 = _mm512_loadu_pd(xs + j + 8);
+        __m512d a0 = _mm512_set1_pd(coeffs[size - 1]);
+        __m512d a1 = a0;
+        __m512d c0 = _mm512_setzero_pd();
+        __m512d c1 = c0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m512d c = _mm512_set1_pd(coeffs[i]);
+            compensatedStep(a0, c0, x0, c);
+            compensatedStep(a1, c1, x1, c);
+        }
+        _mm512_storeu_pd(out + j, _mm512_add_pd(a0, c0));
+        _mm512_storeu_pd(out + j + 8, _mm512_add_pd(a1, c1));
+    }
+    for (; j < count; j += 8) {
+        std::size_t lanes = count - j < 8 ? count - j : 8;
+        __mmask8 mask = static_cast<__mmask8>((1u << lanes) - 1);
+        __m512d x0 = _mm512_maskz_loadu_pd(mask, xs + j);
+        __m512d a0 = _mm512_set1_pd(coeffs[size - 1]);
+        __m512d c0 = _mm512_setzero_pd();
+        for (std::size_t i = size - 1; i-- > 0;) {
+            compensatedStep(a0, c0, x0, _mm512_set1_pd(coeffs[i]));
+        }
+        _mm512_mask_storeu_pd(out + j, mask, _mm512_add_pd(a0, c0));
+    }
+}
+
+POLYRANK_TARGET("avx512f")
+inline void compensatedHornerAvx512(const float* coeffs, std::size_t size,
+                                    const float* xs, float* out, std::size_t count) {
+    std::size_t j = 0;
+    for (; j + 32 <= count; j += 32) {
+        __m512 x0 = _mm512_loadu_ps(xs + j);
+        __m512 x1 = _mm512_loadu_ps(xs + j + 16);
+        __m512 a0 = _mm512_set1_ps(coeffs[size - 1]);
+        __m512 a1 = a0;
+        __m512 c0 = _mm512_setzero_ps();
+        __m512 c1 = c0;
+        for (std::size_t i = size - 1; i-- > 0;) {
+            __m512 c = _mm512_set1_ps(coeffs[i]);
+            compensatedStep(a0, c0, x0, c);
+            compensatedStep(a1, c1, x1, c);
+        }
+        _mm512_storeu_ps(out + j, _mm512_add_ps(a0, c0));
+        _mm512_storeu_ps(out + j + 16, _mm512_add_ps(a1, c1));
+    }
+    for (; j < count; j += 16) {
+        std::size_t lanes = count - j < 16 ? count - j : 16;
+        __mmask16 mask = static_cast<__mmask16>((1u << lanes) - 1);
+        __m512 x0 = _mm512_maskz_loadu_ps(mask, xs + j);
+        __m512 a0 = _mm512_set1_ps(coeffs[size - 1]);
+        __m512 c0 = _mm512_setzero_ps();
+        for (std::size_t i = size - 1; i-- > 0;) {
+            compensatedStep(a0, c0, x0, _mm512_set1_ps(coeffs[i]));
+        }
+        _mm512_mask_storeu_ps(out + j, mask, _mm512_add_ps(a0, c0));
+    }
+}
+#endif
+
+template<typename T>
+inline void hornerMany(const T* coeffs, std::size_t size,
+                       const T* xs, T* out, std::size_t count) {
+    if (size == 0) {
+        for (std::size_t j = 0; j < count; ++j) out[j] = T(0);
+        return;
+    }
+#ifdef POLYRANK_X86
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+        switch (detectSimdLevel()) {
+            case SimdLevel::Avx512:
+                hornerAvx512(coeffs, size, xs, out, count);
+                return;
+            case SimdLevel::Avx2:
+                hornerAvx2(coeffs, size, xs, out, count);
+                return;
+            default:
+                break;
+        }
+    }
+#endif
+    hornerScalar(coeffs, size, xs, out, count);
+}
+
+template<typename T>
+inline void compensatedHornerMany(const T* coeffs, std::size_t size,
+                                  const T* xs, T* out, std::size_t count) {
+    if (size == 0) {
+        for (std::size_t j = 0; j < count; ++j) out[j] = T(0);
+        return;
+    }
+#ifdef POLYRANK_X86
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+        switch (detectSimdLevel()) {
+            case SimdLevel::Avx512:
+                compensatedHornerAvx512(coeffs, size, xs, out, count);
+                return;
+            case SimdLevel::Avx2:
+                compensatedHornerAvx2(coeffs, size, xs, out, count);
+                return;
+            default:
+                break;
+        }
+    }
+#endif
+    compensatedHornerScalar(coeffs, size, xs, out, count);
+}
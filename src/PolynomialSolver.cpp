@@ -1,80 +1,397 @@
 #include "PolynomialSolver.h"
+#include "AberthSolver.h"
+#include "ClosedFormSolver.h"
+#include "CompanionSolver.h"
+#include "DoubleDouble.h"
+#include "RealRootIsolator.h"
+#include "SquareFreeDecomposition.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
-#include <cstdlib>
-#include <ctime>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
-static double derivative(const Polynomial<double>& p, double x) {
-    double h = 1e-6;
-    return (p.evaluate(x + h) - p.evaluate(x - h)) / (2 * h);
+template<typename T>
+std::span<T> PolynomialSolver<T>::deflateInPlace(std::span<T> asc, T root) {
+    // q[i-1] = a[i] + root * q[i] overwrites a[i]; a[0] only fed the remainder.
+    size_t n = asc.size() - 1;
+    for (size_t i = n - 1; i >= 1; --i) {
+        asc[i] += root * asc[i + 1];
+    }
+    return asc.subspan(1);
+}
+
+template<typename T>
+std::vector<T> PolynomialSolver<T>::solveNewton(const Polynomial<T>& poly,
+                                                T tolerance,
+                                                int maxIterations) {
+    auto roots = solveNewton(poly, SolverContext<T>::forThisThread(), tolerance, maxIterations);
+    return std::vector<T>(roots.begin(), roots.end());
+}
+
+template<typename T>
+std::span<const T> PolynomialSolver<T>::solveNewton(const Polynomial<T>& poly,
+                                                    SolverContext<T>& context,
+                                                    T tolerance,
+                                                    int maxIterations) {
+    auto& roots = context.roots();
+    roots.clear();
+    int deg = poly.degree();
+    if (deg <= 0) return roots;
+
+    context.restart();
+
+    switch (deg) {
+        case 1: return solveFixedDegree<1>(poly, context, tolerance, maxIterations);
+        case 2: return solveFixedDegree<2>(poly, context, tolerance, maxIterations);
+        case 3: return solveFixedDegree<3>(poly, context, tolerance, maxIterations);
+        case 4: return solveFixedDegree<4>(poly, context, tolerance, maxIterations);
+        default: break;
+    }
+
+    std::span<T> p = context.loadScratch(poly.coeffs());
+    roots.reserve(deg);
+    for (int k = 0; k < deg; ++k) {
+        T root = newtonSingleRoot(CoefficientView<T>(p), context.nextGuess(), tolerance, maxIterations);
+        roots.push_back(root);
+
+        p = deflateInPlace(p, root);
+
+        if (p.size() <= 1)
+            break;
+    }
+    return roots;
 }
 
-static double newtonSingleRoot(const Polynomial<double>& p, double x0,
-                               double tolerance, int maxIterations) {
-    double x = x0;
-    for (int i = 0; i < maxIterations; ++i) {
-        double fx = p.evaluate(x);
-        double dfx = derivative(p, x);
+template<typename T>
+SolveResult<T> PolynomialSolver<T>::solveNewton(const Polynomial<T>& poly,
+                                                SolverContext<T>& context,
+                                                const SolveBudget& budget,
+                                                T tolerance,
+                                                int maxIterations,
+                                                const RootSink<T>& sink) {
+    SolveResult<T> result;
+    int deg = poly.degree();
+    if (deg <= 0) return result;
 
-        if (std::fabs(dfx) < 1e-12) {
-            x += 0.1;
-            continue;
+    context.restart();
+    std::span<T> p = context.loadScratch(poly.coeffs());
+    std::vector<std::complex<T>> estimates;
+    result.roots.reserve(deg);
+
+    for (int k = 0; k < deg; ++k) {
+        NewtonOutcome outcome;
+        T root = newtonSingleRoot(CoefficientView<T>(p), context.nextGuess(), tolerance, maxIterations,
+                                  &budget, &outcome);
+        result.iterations += outcome.steps;
+        if (outcome.status == SolveStatus::Converged) {
+            result.roots.push_back(root);
+            if (sink) sink(root, relativeResidual<T>(poly.coeffs(), std::complex<T>(root)));
+        } else {
+            estimates.push_back(root);
+            if (outcome.status != SolveStatus::IterationLimit) {
+                result.status = outcome.status;
+                break;
+            }
+            result.status = SolveStatus::IterationLimit;
         }
+        budget.report(result.roots.size());
+
+        p = deflateInPlace(p, root);
+
+        if (p.size() <= 1)
+            break;
+    }
 
-        double xNext = x - fx / dfx;
-        if (std::fabs(xNext - x) < tolerance)
-            return xNext;
+    result.converged = result.roots.size();
+    result.roots.insert(result.roots.end(), estimates.begin(), estimates.end());
+    return result;
+}
 
-        x = xNext;
+template<typename T>
+T PolynomialSolver<T>::refineRoot(const Polynomial<T>& poly, T x, T tolerance, int maxIterations) {
+    using std::abs;
+    auto d = poly.evaluateDerivatives(x);
+    for (int i = 0; i < maxIterations && d.value != 0 && d.first != 0; ++i) {
+        T step = d.value / d.first;
+        T next = x - step;
+        auto dNext = poly.evaluateDerivatives(next);
+        if (!(abs(dNext.value) < abs(d.value)))
+            break;
+        x = next;
+        d = dNext;
+        if (abs(step) <= tolerance * std::max(T(1), abs(x)))
+            break;
     }
     return x;
 }
 
-static Polynomial<double> deflatePoly(const Polynomial<double>& p, double root) {
-    const auto& asc = p.coeffs();
-    int n = asc.size() - 1;
-    if (n <= 0) return Polynomial<double>({ 0.0 });
+template<typename T>
+std::vector<std::complex<T>> PolynomialSolver<T>::solveAberth(const Polynomial<T>& poly,
+                                                              T tolerance,
+                                                              int maxIterations) {
+    if (poly.degree() <= 0) return {};
+    return AberthSolver<T>::solve(poly, tolerance, maxIterations);
+}
+
+template<typename T>
+std::vector<std::complex<T>> PolynomialSolver<T>::solveAberth(const Polynomial<std::complex<T>>& poly,
+                                                              T tolerance,
+                                                              int maxIterations) {
+    if (poly.degree() <= 0) return {};
+    return AberthSolver<T>::solve(poly, tolerance, maxIterations);
+}
+
+template<typename T>
+std::vector<std::complex<T>> PolynomialSolver<T>::solveAberthParallel(const Polynomial<T>& poly,
+                                                                      unsigned threads,
+                                                                      T tolerance,
+                                                                      int maxIterations) {
+    if (poly.degree() <= 0) return {};
+    return AberthSolver<T>::solveParallel(poly, threads, tolerance, maxIterations);
+}
 
-    std::vector<double> desc(n + 1);
-    for (int i = 0; i <= n; ++i)
-        desc[n - i] = asc[i];
+template<typename T>
+std::vector<std::complex<T>> PolynomialSolver<T>::solveClosedForm(const Polynomial<T>& poly) {
+    if (poly.degree() <= 0) return {};
+    auto roots = ClosedFormSolver<T>::solve(poly.coeffs());
+    return std::vector<std::complex<T>>(roots.begin(), roots.end());
+}
 
-    std::vector<double> qdesc(n);
-    double b = desc[0];
-    qdesc[0] = b;
+template<typename T>
+std::vector<std::complex<T>> PolynomialSolver<T>::solveCompanion(const Polynomial<T>& poly) {
+    if (poly.degree() <= 0) return {};
+    return CompanionSolver<T>::solve(poly);
+}
 
-    for (int i = 1; i <= n - 1; ++i) {
-        b = desc[i] + root * b;
-        qdesc[i] = b;
+template<typename T>
+std::vector<T> PolynomialSolver<T>::solveReal(const Polynomial<T>& poly, T tolerance) {
+    if (poly.degree() <= 0) return {};
+    return RealRootIsolator<T>(poly).solve(tolerance);
+}
+
+template<typename T>
+int PolynomialSolver<T>::countRealRootsIn(const Polynomial<T>& poly, T a, T b) {
+    if (poly.degree() <= 0) return 0;
+    return RealRootIsolator<T>(poly).countRealRootsIn(a, b);
+}
+
+template<typename T>
+std::vector<std::complex<T>> PolynomialSolver<T>::solve(const Polynomial<T>& poly,
+                                                        SolverEngine engine,
+                                                        T tolerance,
+                                                        int maxIterations) {
+    return solve(poly, SolveBudget{}, engine, tolerance, maxIterations).roots;
+}
+
+template<typename T>
+SolveResult<T> PolynomialSolver<T>::solve(const Polynomial<T>& poly,
+                                          const SolveBudget& budget,
+                                          SolverEngine engine,
+                                          T tolerance,
+                                          int maxIterations,
+                                          const RootSink<T>& sink) {
+    if (poly.degree() <= 0) return {};
+
+    auto finished = [&](std::vector<std::complex<T>> roots) {
+        SolveResult<T> result;
+        result.roots = std::move(roots);
+        result.converged = result.roots.size();
+        budget.report(result.converged);
+        if (sink) {
+            for (const auto& z : result.roots) sink(z, relativeResidual<T>(poly.coeffs(), z));
+        }
+        return result;
+    };
+
+    if (engine == SolverEngine::Auto) {
+        if (poly.degree() <= ClosedFormSolver<T>::kMaxDegree)
+            engine = SolverEngine::ClosedForm;
+        else if (poly.degree() >= AberthSolver<T>::kParallelDegree)
+            return AberthSolver<T>::solveParallel(poly, budget, 0, tolerance, maxIterations, sink);
+        else
+            engine = SolverEngine::Aberth;
+    }
+
+    switch (engine) {
+        case SolverEngine::Newton:
+            return solveNewton(poly, SolverContext<T>::forThisThread(), budget, tolerance, maxIterations, sink);
+        case SolverEngine::Companion:
+            return finished(solveCompanion(poly));
+        case SolverEngine::ClosedForm:
+            return finished(solveClosedForm(poly));
+        case SolverEngine::Aberth:
+        default:
+            return AberthSolver<T>::solve(poly, budget, tolerance, maxIterations, sink);
     }
+}
 
-    std::vector<double> qasc(n);
-    for (int i = 0; i < n; ++i)
-        qasc[n - 1 - i] = qdesc[i];
+template<typename T>
+SolveResult<T> PolynomialSolver<T>::solveWithMultiplicity(const Polynomial<T>& poly,
+                                                          const SolveBudget& budget,
+                                                          SolverEngine engine,
+                                                          T tolerance,
+                                                          int maxIterations,
+                                                          const RootSink<T>& sink) {
+    if (poly.degree() <= 0) return {};
+
+    // The factors report progress themselves, each from zero; count roots
+    // with their multiplicity here instead so the caller sees one total.
+    SolveBudget inner = budget;
+    inner.progress = nullptr;
+    std::size_t settled = 0;
+    int multiplicity = 1;
+    RootSink<T> counting = [&](const std::complex<T>& z, T residual) {
+        settled += multiplicity;
+        budget.report(settled);
+        if (sink) sink(z, residual);
+    };
+
+    SolveResult<T> result;
+    std::vector<std::complex<T>> unfinished;
+    std::vector<int> unfinishedMultiplicities;
+    for (const auto& factor : SquareFreeDecomposition<T>::decompose(poly)) {
+        multiplicity = factor.multiplicity;
+        auto part = solve(factor.poly, inner, engine, tolerance, maxIterations, counting);
+        result.iterations += part.iterations;
+        for (std::size_t i = 0; i < part.roots.size(); ++i) {
+            auto& roots = i < part.converged ? result.roots : unfinished;
+            auto& multiplicities = i < part.converged ? result.multiplicities : unfinishedMultiplicities;
+            roots.push_back(part.roots[i]);
+            multiplicities.push_back(factor.multiplicity);
+        }
+        if (!part.complete()) {
+            result.status = part.status;
+            if (part.status != SolveStatus::IterationLimit) break;
+        }
+    }
 
-    return Polynomial<double>(qasc);
+    result.converged = result.roots.size();
+    result.roots.insert(result.roots.end(), unfinished.begin(), unfinished.end());
+    result.multiplicities.insert(result.multiplicities.end(),
+                                 unfinishedMultiplicities.begin(), unfinishedMultiplicities.end());
+    return result;
 }
 
-std::vector<double> PolynomialSolver::solveNewton(const Polynomial<double>& poly,
-                                                  double tolerance,
-                                                  int maxIterations) {
-    Polynomial<double> p = poly;
-    std::vector<double> roots;
+template<typename T>
+BatchRoots<T> PolynomialSolver<T>::solveBatch(std::span<const Polynomial<T>> polys,
+                                              const BatchOptions<T>& options) {
+    // Every polynomial gets degree-many slots up front, so workers write
+    // disjoint ranges without locking; the gaps are squeezed out afterwards.
+    BatchRoots<T> out;
+    std::vector<std::size_t> slots(polys.size() + 1, 0);
+    for (std::size_t i = 0; i < polys.size(); ++i) {
+        slots[i + 1] = slots[i] + std::max(0, polys[i].degree());
+    }
+    out.roots.resize(slots.back());
+    std::vector<std::size_t> counts(polys.size(), 0);
 
-    int deg = p.degree();
-    if (deg <= 0) return roots;
+    auto solveOne = [&](SolverContext<T>& context, std::size_t i) {
+        T* dest = out.roots.data() + slots[i];
+        if (options.engine == SolverEngine::Newton) {
+            auto roots = solveNewton(polys[i], context, options.tolerance, options.maxIterations);
+            std::copy(roots.begin(), roots.end(), dest);
+            counts[i] = roots.size();
+        } else {
+            // The batch already keeps every core busy; Auto's parallel Aberth
+            // would start another pool per polynomial on top of it.
+            SolverEngine engine = options.engine;
+            if (engine == SolverEngine::Auto && polys[i].degree() >= AberthSolver<T>::kParallelDegree) {
+                engine = SolverEngine::Aberth;
+            }
+            auto all = solve(polys[i], engine, options.tolerance, options.maxIterations);
+            auto real = realRoots(all);
+            std::copy(real.begin(), real.end(), dest);
+            counts[i] = real.size();
+        }
+    };
 
-    std::srand((unsigned)std::time(nullptr));
+    if (options.scheduler) {
+        TaskScheduler& scheduler = *options.scheduler;
+        const std::size_t chunk = std::max<std::size_t>(1, polys.size() / (scheduler.workerCount() * 8));
+        TaskGroup group(scheduler);
+        for (std::size_t begin = 0; begin < polys.size(); begin += chunk) {
+            std::size_t end = std::min(begin + chunk, polys.size());
+            group.run([&, begin, end] {
+                SolverContext<T> context(options.seed);
+                for (std::size_t i = begin; i < end && !group.isCancelled(); ++i) solveOne(context, i);
+            });
+        }
+        group.wait();
+    } else {
+        unsigned threads = options.threads;
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<std::size_t>(threads, std::max<std::size_t>(1, polys.size())));
 
-    for (int k = 0; k < deg; ++k) {
-        double guess = (std::rand() % 200 - 100) / 10.0;
+        const std::size_t chunk = std::max<std::size_t>(1, polys.size() / (threads * 8));
+        std::atomic<std::size_t> cursor{0};
+        std::exception_ptr failure;
+        std::mutex failureMutex;
 
-        double root = newtonSingleRoot(p, guess, tolerance, maxIterations);
-        roots.push_back(root);
+        auto worker = [&] {
+            SolverContext<T> context(options.seed);
+            try {
+                for (;;) {
+                    std::size_t begin = cursor.fetch_add(chunk);
+                    if (begin >= polys.size()) break;
+                    std::size_t end = std::min(begin + chunk, polys.size());
+                    for (std::size_t i = begin; i < end; ++i) solveOne(context, i);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (!failure) failure = std::current_exception();
+                cursor.store(polys.size());
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        try {
+            for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+        } catch (const std::system_error&) {
+            // Workers pull chunks from the cursor, so the ones that started
+            // and this thread finish the batch between them.
+        }
+        worker();
+        for (auto& thread : pool) thread.join();
+        if (failure) std::rethrow_exception(failure);
+    }
 
-        p = deflatePoly(p, root);
+    out.offsets.reserve(polys.size() + 1);
+    out.offsets.push_back(0);
+    std::size_t write = 0;
+    for (std::size_t i = 0; i < polys.size(); ++i) {
+        std::copy_n(out.roots.begin() + slots[i], counts[i], out.roots.begin() + write);
+        write += counts[i];
+        out.offsets.push_back(write);
+    }
+    out.roots.resize(write);
+    return out;
+}
 
-        if (p.degree() <= 0)
-            break;
+template<typename T>
+std::vector<T> PolynomialSolver<T>::realRoots(std::span<const std::complex<T>> roots,
+                                              T imagTolerance) {
+    std::vector<T> real;
+    for (const auto& z : roots) {
+        if (isRealRoot(z, imagTolerance))
+            real.push_back(z.real());
     }
-    return roots;
+    std::sort(real.begin(), real.end());
+    return real;
 }
+
+template class PolynomialSolver<float>;
+template class PolynomialSolver<double>;
+template class PolynomialSolver<long double>;
+
+// DoubleDouble has no std::complex or random distribution support, so only
+// the real Newton path is built for it.
+template std::vector<DoubleDouble> PolynomialSolver<DoubleDouble>::solveNewton(
+    const Polynomial<DoubleDouble>&, DoubleDouble, int);
+template std::span<const DoubleDouble> PolynomialSolver<DoubleDouble>::solveNewton(
+    const Polynomial<DoubleDouble>&, SolverContext<DoubleDouble>&, DoubleDouble, int);
+template DoubleDouble PolynomialSolver<DoubleDouble>::refineRoot(
+    const Polynomial<DoubleDouble>&, DoubleDouble, DoubleDouble, int);
@@ -1,18 +1,190 @@
 #pragma once
 #include <vector>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <span>
 #include "Polynomial.h"
+#include "FixedPolynomial.h"
+#include "PolynomialConcept.h"
+#include "SolverContext.h"
+#include "SolveBudget.h"
+#include "RootSink.h"
+#include "TaskScheduler.h"
 #include "Exceptions.h"
 
+enum class SolverEngine {
+    Newton,     // one real root at a time with deflation
+    Aberth,     // simultaneous iteration on all complex roots
+    Companion,  // eigenvalues of the balanced companion matrix
+    ClosedForm, // direct formulas, degree 4 at most
+    Auto        // closed form up to degree 4, Aberth above
+};
+
+template<typename T>
+struct BatchOptions {
+    SolverEngine engine = SolverEngine::Newton;
+    T tolerance = T(1e-6);
+    int maxIterations = 1000;
+    unsigned threads = 0;  // 0 = all cores
+    std::uint64_t seed = SolverContext<T>::kDefaultSeed;
+    TaskScheduler* scheduler = nullptr;  // when set, run as tasks there instead of on own threads
+};
+
+// Real roots of a whole batch packed back to back; polynomial i owns
+// roots[offsets[i], offsets[i + 1]).
+template<typename T>
+struct BatchRoots {
+    std::vector<T> roots;
+    std::vector<std::size_t> offsets;
+
+    std::size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    std::span<const T> operator[](std::size_t i) const {
+        return std::span<const T>(roots.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+};
+
 template<typename T>
 class PolynomialSolver {
 public:
     using FunctionType = std::function<T(T)>;
     
+    // How a single-root Newton run ended.
+    struct NewtonOutcome {
+        SolveStatus status = SolveStatus::Converged;
+        int steps = 0;
+    };
+    
+    // Uses this thread's SolverContext, so the result depends only on the input.
     static std::vector<T> solveNewton(const Polynomial<T>& poly,
                                     T tolerance = 1e-6,
                                     int maxIterations = 1000);
     
+    // Roots land in context.roots() and stay valid until its next solve;
+    // deflation runs in the context's scratch, so a warm context never allocates.
+    static std::span<const T> solveNewton(const Polynomial<T>& poly,
+                                          SolverContext<T>& context,
+                                          T tolerance = 1e-6,
+                                          int maxIterations = 1000);
+    
+    // Polls the budget every kBudgetPollSteps Newton steps. A root that runs
+    // out of iterations is kept as an estimate and deflation carries on; an
+    // interruption stops the solve with the roots found so far. The sink
+    // sees each converged root before the next one is started.
+    static SolveResult<T> solveNewton(const Polynomial<T>& poly,
+                                      SolverContext<T>& context,
+                                      const SolveBudget& budget,
+                                      T tolerance = 1e-6,
+                                      int maxIterations = 1000,
+                                      const RootSink<T>& sink = {});
+    
+    // Degree known at compile time: deflation stays in std::array and unrolls.
+    template<int N>
+    static std::array<T, N> solveNewton(const FixedPolynomial<T, N>& poly,
+                                        T tolerance = 1e-6,
+                                        int maxIterations = 1000) {
+        auto& context = SolverContext<T>::forThisThread();
+        context.restart();
+        return solveNewton(poly, context, tolerance, maxIterations);
+    }
+    
+    template<int N>
+    static std::array<T, N> solveNewton(const FixedPolynomial<T, N>& poly,
+                                        SolverContext<T>& context,
+                                        T tolerance = 1e-6,
+                                        int maxIterations = 1000) {
+        std::array<T, N> roots{};
+        solveFixed(poly, roots.data(), context, tolerance, maxIterations);
+        return roots;
+    }
+    
+    // Plain Newton on poly from x, for polishing a root found elsewhere: stops
+    // once a step is below tolerance * max(1, |x|) or |p(x)| stops shrinking,
+    // and never returns a point with a larger residual than it started from.
+    static T refineRoot(const Polynomial<T>& poly, T x, T tolerance, int maxIterations = 100);
+    
+    // All roots, complex included, by Aberth-Ehrlich simultaneous iteration.
+    static std::vector<std::complex<T>> solveAberth(const Polynomial<T>& poly,
+                                                    T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                                    int maxIterations = 500);
+    
+    static std::vector<std::complex<T>> solveAberth(const Polynomial<std::complex<T>>& poly,
+                                                    T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                                    int maxIterations = 500);
+    
+    // Quadratic, cubic and quartic formulas; throws above degree 4.
+    static std::vector<std::complex<T>> solveClosedForm(const Polynomial<T>& poly);
+    
+    // Eigenvalues of the balanced companion matrix by shifted Hessenberg QR.
+    static std::vector<std::complex<T>> solveCompanion(const Polynomial<T>& poly);
+    
+    // Distinct real roots, ascending, from Sturm isolation plus safeguarded Newton.
+    // Unlike solveNewton it never reports a point that is not a root.
+    static std::vector<T> solveReal(const Polynomial<T>& poly,
+                                    T tolerance = std::numeric_limits<T>::epsilon() * 16);
+    
+    // Distinct real roots in (a, b] without solving for them.
+    static int countRealRootsIn(const Polynomial<T>& poly, T a, T b);
+    
+    // All roots from the chosen engine; Newton's real roots come back with zero
+    // imaginary part. Auto also switches to the parallel Aberth sweep at
+    // AberthSolver<T>::kParallelDegree. Companion and ClosedForm ignore the limits.
+    static std::vector<std::complex<T>> solve(const Polynomial<T>& poly,
+                                              SolverEngine engine = SolverEngine::Auto,
+                                              T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                              int maxIterations = 500);
+    
+    // Same dispatch under a deadline / cancel flag. Closed form and companion
+    // runs are short and uninterruptible; the iterative engines stop early
+    // and hand back what they have. The sink streams roots as they settle;
+    // closed form and companion deliver theirs together at the end.
+    static SolveResult<T> solve(const Polynomial<T>& poly,
+                                const SolveBudget& budget,
+                                SolverEngine engine = SolverEngine::Auto,
+                                T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                int maxIterations = 500,
+                                const RootSink<T>& sink = {});
+    
+    // Splits off repeated roots with SquareFreeDecomposition first and solves
+    // each square-free factor on its own, so no engine ever sees a multiple
+    // root and stalls at linear convergence. Each distinct root comes back
+    // once, with result.multiplicities filled in; iterations add up over the
+    // factors and the budget covers them all.
+    static SolveResult<T> solveWithMultiplicity(const Polynomial<T>& poly,
+                                                const SolveBudget& budget = {},
+                                                SolverEngine engine = SolverEngine::Auto,
+                                                T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                                int maxIterations = 500,
+                                                const RootSink<T>& sink = {});
+    
+    // Many polynomials over a worker pool, each worker with its own
+    // SolverContext seeded from options.seed, so the output does not depend
+    // on the thread count. Newton's roots are kept as reported; other engines
+    // contribute their real roots.
+    static BatchRoots<T> solveBatch(std::span<const Polynomial<T>> polys,
+                                    const BatchOptions<T>& options = {});
+    
+    // Same iteration with each sweep sharded across worker threads (0 = all cores).
+    static std::vector<std::complex<T>> solveAberthParallel(const Polynomial<T>& poly,
+                                                            unsigned threads = 0,
+                                                            T tolerance = std::numeric_limits<T>::epsilon() * 4,
+                                                            int maxIterations = 500);
+    
+    static bool isRealRoot(const std::complex<T>& z,
+                           T imagTolerance = std::sqrt(std::numeric_limits<T>::epsilon())) {
+        return std::abs(z.imag()) <= imagTolerance * std::max(T(1), std::abs(z));
+    }
+    
+    // Real parts of the roots whose imaginary part is negligible, ascending.
+    static std::vector<T> realRoots(std::span<const std::complex<T>> roots,
+                                    T imagTolerance = std::sqrt(std::numeric_limits<T>::epsilon()));
+    
     static std::vector<T> solveNewtonWithFunction(FunctionType func,
                                                 FunctionType deriv,
                                                 T tolerance = 1e-6,
@@ -22,11 +194,73 @@ public:
     static T evaluateDerivative(FunctionType func, T x);
 
 private:
-    static T newtonSingleRoot(const Polynomial<T>& p, T x0,
-                            T tolerance, int maxIterations);
+    static constexpr int kBudgetPollSteps = 64;
+    
+    template<PolynomialLike P>
+    static T newtonSingleRoot(const P& p, T x0, T tolerance, int maxIterations,
+                              const SolveBudget* budget = nullptr, NewtonOutcome* outcome = nullptr) {
+        using std::abs;       // unqualified so DoubleDouble's overloads are found
+        using std::isfinite;
+        NewtonOutcome local;
+        NewtonOutcome& out = outcome ? *outcome : local;
+        out = {};
+        T x = x0;
+        for (int i = 0; i < maxIterations; ++i) {
+            if (budget && i % kBudgetPollSteps == 0) {
+                if (auto stop = budget->interruption()) {
+                    out.status = *stop;
+                    return x;
+                }
+            }
+            out.steps = i + 1;
+            
+            auto d = p.evaluateDerivatives(x, true);
+            if (d.value == 0)
+                return x;
+            
+            if (abs(d.first) < T(1e-12)) {
+                x += T(0.1);
+                continue;
+            }
+            
+            // Halley's step, falling back to Newton when its denominator degenerates.
+            T step = d.value / d.first;
+            T denom = T(1) - step * d.second / (2 * d.first);
+            if (isfinite(denom) && abs(denom) > T(0.5))
+                step /= denom;
+            
+            T xNext = x - step;
+            if (abs(xNext - x) < tolerance)
+                return xNext;
+            
+            x = xNext;
+        }
+        out.status = SolveStatus::IterationLimit;
+        return x;
+    }
+    
+    template<int N>
+    static void solveFixed(const FixedPolynomial<T, N>& p, T* roots, SolverContext<T>& context,
+                           T tolerance, int maxIterations) {
+        if constexpr (N > 0) {
+            roots[0] = newtonSingleRoot(p, context.nextGuess(), tolerance, maxIterations);
+            solveFixed(p.deflate(roots[0]), roots + 1, context, tolerance, maxIterations);
+        }
+    }
+    
+    template<int N>
+    static std::span<const T> solveFixedDegree(const Polynomial<T>& poly, SolverContext<T>& context,
+                                               T tolerance, int maxIterations) {
+        auto fixed = solveNewton(FixedPolynomial<T, N>::fromPolynomial(poly),
+                                 context, tolerance, maxIterations);
+        auto& roots = context.roots();
+        roots.assign(fixed.begin(), fixed.end());
+        return roots;
+    }
     
     static T newtonSingleRootWithFunction(FunctionType func, FunctionType deriv,
                                         T x0, T tolerance, int maxIterations);
     
-    static Polynomial<T> deflatePoly(const Polynomial<T>& p, T root);
+    // Synthetic division by (x - root) in place; the quotient is the returned tail.
+    static std::span<T> deflateInPlace(std::span<T> asc, T root);
 };
\ No newline at end of file
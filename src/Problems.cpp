@@ -1,15 +1,66 @@
 #include "Problems.h"
 #include "DbManager.h"
+#include "ExpressionParser.h"
 #include <sstream>
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cmath>
+#include <random>
+#include <stdexcept>
+
+int PolynomialProblem::checkAnswers(std::span<const std::string> answers, std::span<double> scores,
+                                    TaskScheduler& scheduler) {
+    if (scores.size() < answers.size()) {
+        throw std::invalid_argument("checkAnswers: " + std::to_string(answers.size()) + " answers but only " +
+                                    std::to_string(scores.size()) + " scores");
+    }
+    const size_t chunk = 64;
+    std::atomic<int> correct{0};
+    TaskGroup group(scheduler);
+    for (size_t begin = 0; begin < answers.size(); begin += chunk) {
+        size_t end = std::min(begin + chunk, answers.size());
+        group.run([&, begin, end] {
+            int local = 0;
+            for (size_t i = begin; i < end; ++i) {
+                if (checkAnswer(answers[i], scores[i])) ++local;
+            }
+            correct.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    group.wait();
+    return correct.load();
+}
 
 // Evaluation Problem
 EvaluationProblem::EvaluationProblem(const Problem& p) : PolynomialProblem(p) {
     poly_ = Polynomial<double>::parse(p.polyCoeffs);
+    // The point is the number after "x=" in the description; problems stored
+    // before it varied all use x=2.
     x_ = 2.0;
-    expected_ = poly_.evaluate(x_);
+    std::string point = "2";
+    size_t at = p.description.find("x=");
+    if (at != std::string::npos) {
+        point = p.description.substr(at + 2);
+        point = point.substr(0, point.find_first_not_of("+-0123456789./"));
+        try {
+            x_ = std::stod(point);
+        } catch (const std::exception&) {
+            // Keep the default
+            point = "2";
+        }
+    }
+
+    Rational exactX;
+    auto exactPoly = Polynomial<Rational>::tryParse(p.polyCoeffs);
+    if (exactPoly && Rational::tryParse(point, exactX) && exactX.isInteger() &&
+        std::all_of(exactPoly->coeffs().begin(), exactPoly->coeffs().end(),
+                    [](const Rational& c) { return c.isInteger(); })) {
+        exact_ = exactPoly->evaluate(exactX);
+        expected_ = static_cast<double>(*exact_);
+    } else {
+        expected_ = poly_.evaluate(x_, EvaluationMode::Compensated);
+    }
 }
 
 std::string EvaluationProblem::getPrompt() const {
@@ -22,6 +73,17 @@ std::string EvaluationProblem::getPrompt() const {
 }
 
 bool EvaluationProblem::checkAnswer(const std::string& userAnswer, double& score) {
+    if (exact_) {
+        std::string answer = userAnswer;
+        answer.erase(std::remove_if(answer.begin(), answer.end(), ::isspace), answer.end());
+        Rational value;
+        if (Rational::tryParse(answer, value) && value == *exact_) {
+            score = 10;
+            return true;
+        }
+        score = 0;
+        return false;
+    }
     try {
         double ans = std::stod(userAnswer);
         double diff = std::fabs(ans - expected_);
@@ -38,21 +100,23 @@ bool EvaluationProblem::checkAnswer(const std::string& userAnswer, double& score
 
 std::string EvaluationProblem::getSolution() const {
     std::ostringstream oss;
-    oss << "The value of p(" << x_ << ") is " << expected_;
+    oss << "The value of p(" << x_ << ") is " << getCorrectAnswer();
     return oss.str();
 }
 
 std::string EvaluationProblem::getCorrectAnswer() const {
+    if (exact_) return exact_->toString();
     return std::to_string(expected_);
 }
 
 // Root Finding Problem
 RootFindingProblem::RootFindingProblem(const Problem& p, DbManager& db) 
-    : PolynomialProblem(p) {
-    poly_ = Polynomial<double>::parse(p.polyCoeffs);
+    : PolynomialProblem(p),
+      poly_(Polynomial<double>::parse(p.polyCoeffs)),
+      isolator_(poly_) {
     roots_ = db.getCachedRoots(p.id);
     if (roots_.empty()) {
-        roots_ = PolynomialSolver<double>::solveNewton(poly_);
+        roots_ = isolator_.solve();
         db.cacheRoots(p.id, roots_);
     }
 }
@@ -68,12 +132,11 @@ std::string RootFindingProblem::getPrompt() const {
 
 bool RootFindingProblem::checkAnswer(const std::string& userAnswer, double& score) {
     try {
+        // A Sturm count around the answer; no dependence on the cached roots.
         double ans = std::stod(userAnswer);
-        for (double r : roots_) {
-            if (std::fabs(ans - r) < 1e-3) {
-                score = 10;
-                return true;
-            }
+        if (isolator_.countRealRootsIn(ans - 1e-3, ans + 1e-3) > 0) {
+            score = 10;
+            return true;
         }
     } catch (const std::exception&) {
         // Invalid input
@@ -100,8 +163,16 @@ std::string RootFindingProblem::getCorrectAnswer() const {
 // Simplification Problem
 SimplificationProblem::SimplificationProblem(const Problem& p) 
     : PolynomialProblem(p) {
-    expected_ = "x^2+2x+1";
-    polynomial_ = "(x+1)^2";
+    // The expression is stored in polyCoeffs; problems stored before that
+    // hold the coefficient list "1,2,1" and were all (x+1)^2.
+    if (p.polyCoeffs.empty() || p.polyCoeffs.find(',') != std::string::npos) {
+        polynomial_ = "(x+1)^2";
+    } else {
+        polynomial_ = p.polyCoeffs;
+    }
+    expanded_ = ExpressionParser<Rational>::parse(polynomial_);
+    expected_ = expanded_.toString();
+    expected_.erase(std::remove(expected_.begin(), expected_.end(), ' '), expected_.end());
 }
 
 std::string SimplificationProblem::getPrompt() const {
@@ -109,19 +180,16 @@ std::string SimplificationProblem::getPrompt() const {
     oss << "Problem: " << problem_.title << "\n"
         << problem_.description << "\n"
         << "Simplify: " << polynomial_ << "\n"
-        << "Enter simplified form (no spaces): ";
+        << "Enter the expanded form: ";
     return oss.str();
 }
 
 bool SimplificationProblem::checkAnswer(const std::string& userAnswer, double& score) {
-    std::string user = userAnswer;
-    user.erase(std::remove_if(user.begin(), user.end(), ::isspace), user.end());
-    std::transform(user.begin(), user.end(), user.begin(), ::tolower);
-    
-    std::string exp = expected_;
-    std::transform(exp.begin(), exp.end(), exp.begin(), ::tolower);
-    
-    if (user == exp) {
+    // Any order of terms counts, as long as the answer is expanded and has
+    // the same coefficients.
+    auto answer = ExpressionParser<Rational>::tryParse(userAnswer);
+    if (answer && std::ranges::equal(answer->coeffs(), expanded_.coeffs()) &&
+        ExpressionParser<Rational>::isExpanded(userAnswer)) {
         score = 10;
         return true;
     }
@@ -141,15 +209,24 @@ std::string SimplificationProblem::getCorrectAnswer() const {
 CustomSolutionProblem::CustomSolutionProblem(const Problem& p, DbManager& db)
     : PolynomialProblem(p) {
     poly_ = Polynomial<double>::parse(p.polyCoeffs);
-    roots_ = PolynomialSolver<double>::solveNewton(poly_);
+    auto result = PolynomialSolver<double>::solveWithMultiplicity(poly_);
+    
+    std::vector<std::pair<double, int>> real;
+    for (size_t i = 0; i < result.roots.size(); ++i) {
+        if (PolynomialSolver<double>::isRealRoot(result.roots[i]))
+            real.emplace_back(result.roots[i].real(), result.multiplicity(i));
+    }
+    std::sort(real.begin(), real.end());
     
     std::ostringstream oss;
     oss << "Polynomial: " << poly_.toString() << "\n";
     oss << "Degree: " << poly_.degree() << "\n";
     oss << "Roots: ";
-    for (size_t i = 0; i < roots_.size(); ++i) {
+    for (size_t i = 0; i < real.size(); ++i) {
+        roots_.push_back(real[i].first);
         if (i > 0) oss << ", ";
-        oss << roots_[i];
+        oss << real[i].first;
+        if (real[i].second > 1) oss << " (×" << real[i].second << ")";
     }
     solution_ = oss.str();
 }
@@ -188,6 +265,51 @@ std::unique_ptr<PolynomialProblem> createProblemInstance(const Problem& p, DbMan
     }
 }
 
+namespace {
+
+// "ax+b" with the usual elisions: "x+1", "-x", "3x-2".
+std::string linearTerm(int a, int b) {
+    std::string s = a == 1 ? "x" : a == -1 ? "-x" : std::to_string(a) + "x";
+    if (b > 0) s += "+" + std::to_string(b);
+    if (b < 0) s += std::to_string(b);
+    return s;
+}
+
+// A product or power of linear factors to expand. Easy keeps every factor
+// monic and squares at most; Hard raises to the fourth.
+std::string randomExpression(const std::string& difficulty) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    const int maxLead = difficulty == "Easy" ? 1 : 3;
+    const int maxPower = difficulty == "Easy" ? 2 : difficulty == "Hard" ? 4 : 3;
+    std::uniform_int_distribution<int> constant(-5, 5);
+    std::uniform_int_distribution<int> lead(1, maxLead);
+    std::uniform_int_distribution<int> power(2, maxPower);
+    auto nonZero = [&] {
+        int c = 0;
+        while (c == 0) c = constant(gen);
+        return c;
+    };
+    auto factor = [&] { return "(" + linearTerm(lead(gen), nonZero()) + ")"; };
+
+    switch (std::uniform_int_distribution<int>(0, 3)(gen)) {
+        case 0:
+            return factor() + "^" + std::to_string(power(gen));
+        case 1:
+            return factor() + factor();
+        case 2: {
+            std::string first = factor();
+            std::string second = factor();
+            while (second == first) second = factor();
+            return first + "^2-" + second + "^2";
+        }
+        default:
+            return linearTerm(nonZero(), 0) + factor() + "+" + factor() + "^2";
+    }
+}
+
+}  // namespace
+
 Problem createRandomProblem(ProblemType type, const std::string& difficulty) {
     Problem p;
     p.difficulty = difficulty;
@@ -196,8 +318,10 @@ Problem createRandomProblem(ProblemType type, const std::string& difficulty) {
     switch (type) {
         case ProblemType::Evaluation: {
             auto poly = PolynomialFactory<double>::createRandom(2);
+            std::random_device rd;
+            int x = std::uniform_int_distribution<int>(-3, 3)(rd);
             p.title = "Polynomial Evaluation";
-            p.description = "Evaluate the polynomial at x=2";
+            p.description = "Evaluate the polynomial at x=" + std::to_string(x);
             p.polyCoeffs = PolynomialFactory<double>::coefficientsToString(poly.coeffs());
             break;
         }
@@ -211,7 +335,7 @@ Problem createRandomProblem(ProblemType type, const std::string& difficulty) {
         case ProblemType::Simplification: {
             p.title = "Polynomial Simplification";
             p.description = "Simplify the polynomial expression";
-            p.polyCoeffs = "1,2,1"; // (x+1)^2
+            p.polyCoeffs = randomExpression(difficulty);
             break;
         }
         default:
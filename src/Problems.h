@@ -1,11 +1,16 @@
 #pragma once
 #include <string>
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 #include "Models.h"
 #include "Polynomial.h"
 #include "PolynomialSolver.h"
 #include "PolynomialFactory.h"
+#include "Rational.h"
+#include "RealRootIsolator.h"
+#include "TaskScheduler.h"
 
 class DbManager;
 
@@ -19,6 +24,14 @@ public:
     virtual std::string getSolution() const = 0;
     virtual std::string getCorrectAnswer() const = 0;
     
+    // Grades many submissions as tasks on the scheduler and returns how many
+    // were correct; scores[i] belongs to answers[i], and a scores span shorter
+    // than answers throws std::invalid_argument before any work starts.
+    // checkAnswer must leave the problem unchanged, which every problem type
+    // here does.
+    int checkAnswers(std::span<const std::string> answers, std::span<double> scores,
+                     TaskScheduler& scheduler = TaskScheduler::shared());
+    
     const Problem& getProblem() const { return problem_; }
 
 protected:
@@ -37,6 +50,9 @@ private:
     Polynomial<double> poly_;
     double x_;
     double expected_;
+    // The exact value when the coefficients and x are all integers; answers
+    // are then compared exactly instead of to within a tolerance.
+    std::optional<Rational> exact_;
 };
 
 class RootFindingProblem : public PolynomialProblem {
@@ -49,6 +65,7 @@ public:
 
 private:
     Polynomial<double> poly_;
+    RealRootIsolator<double> isolator_;
     std::vector<double> roots_;
 };
 
@@ -63,6 +80,8 @@ public:
 private:
     std::string expected_;
     std::string polynomial_;
+    // polynomial_ expanded; answers are graded against its coefficients.
+    Polynomial<Rational> expanded_;
 };
 
 class CustomSolutionProblem : public PolynomialProblem {
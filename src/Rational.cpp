@@ -0,0 +1,153 @@
+#include "Rational.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+BigInteger powerOfTen(int exponent) {
+    BigInteger result = 1;
+    BigInteger base = 10;
+    for (; exponent > 0; exponent >>= 1) {
+        if (exponent & 1) result *= base;
+        base *= base;
+    }
+    return result;
+}
+
+bool allDigits(std::string_view s) {
+    return std::all_of(s.begin(), s.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+}  // namespace
+
+Rational::Rational(BigInteger numerator, BigInteger denominator)
+    : num_(std::move(numerator)), den_(std::move(denominator)) {
+    if (den_.isZero()) throw std::domain_error("Rational with a zero denominator");
+    if (den_.isNegative()) {
+        num_ = -num_;
+        den_ = -den_;
+    }
+    if (den_.isOne()) return;
+    BigInteger g = BigInteger::gcd(num_, den_);
+    if (!g.isOne()) {
+        num_ /= g;
+        den_ /= g;
+    }
+}
+
+Rational Rational::reciprocal() const {
+    if (num_.isZero()) throw std::domain_error("Rational division by zero");
+    Rational r;
+    r.num_ = num_.isNegative() ? -den_ : den_;
+    r.den_ = abs(num_);
+    return r;
+}
+
+// Knuth's form: with g = gcd(b, d), a/b + c/d = (a (d/g) + c (b/g)) / (b d / g),
+// and only gcd(numerator, g) can remain to cancel.
+Rational Rational::addSlow(const Rational& a, const Rational& b, bool subtract) {
+    const BigInteger c = subtract ? -b.num_ : b.num_;
+    BigInteger g = BigInteger::gcd(a.den_, b.den_);
+    Rational r;
+    if (g.isOne()) {
+        r.num_ = a.num_ * b.den_ + c * a.den_;
+        r.den_ = a.den_ * b.den_;
+        return r;
+    }
+    BigInteger t = a.num_ * (b.den_ / g) + c * (a.den_ / g);
+    BigInteger g2 = BigInteger::gcd(t, g);
+    r.num_ = t / g2;
+    r.den_ = (a.den_ / g) * (b.den_ / g2);
+    if (r.num_.isZero()) r.den_ = 1;
+    return r;
+}
+
+// Cross-cancelling first keeps the product reduced without a gcd of the
+// (larger) products.
+Rational Rational::multiplySlow(const Rational& a, const Rational& b) {
+    if (a.num_.isZero() || b.num_.isZero()) return Rational();
+    BigInteger g1 = BigInteger::gcd(a.num_, b.den_);
+    BigInteger g2 = BigInteger::gcd(b.num_, a.den_);
+    Rational r;
+    r.num_ = (a.num_ / g1) * (b.num_ / g2);
+    r.den_ = (a.den_ / g2) * (b.den_ / g1);
+    return r;
+}
+
+Rational::operator double() const {
+    if (isInteger()) return static_cast<double>(num_);
+    const double n = static_cast<double>(num_);
+    const double d = static_cast<double>(den_);
+    if (std::isfinite(n) && std::isfinite(d)) return n / d;
+    // Beyond double's range on either side: divide the mantissas and apply
+    // the difference of the binary exponents once, so only the quotient
+    // itself can overflow or underflow.
+    int numExponent = 0;
+    int denExponent = 0;
+    const double numMantissa = frexp(num_, &numExponent);
+    const double denMantissa = frexp(den_, &denExponent);
+    return std::ldexp(numMantissa / denMantissa, numExponent - denExponent);
+}
+
+std::string Rational::toString() const {
+    if (isInteger()) return num_.toString();
+    return num_.toString() + "/" + den_.toString();
+}
+
+bool Rational::tryParse(std::string_view text, Rational& out) {
+    size_t slash = text.find('/');
+    if (slash != std::string_view::npos) {
+        BigInteger numerator, denominator;
+        std::string_view bottom = text.substr(slash + 1);
+        if (!BigInteger::tryParse(text.substr(0, slash), numerator) ||
+            bottom.empty() || !allDigits(bottom) || !BigInteger::tryParse(bottom, denominator) ||
+            denominator.isZero()) {
+            return false;
+        }
+        out = Rational(std::move(numerator), std::move(denominator));
+        return true;
+    }
+
+    bool negative = false;
+    if (!text.empty() && (text.front() == '+' || text.front() == '-')) {
+        negative = text.front() == '-';
+        text.remove_prefix(1);
+    }
+
+    int exponent = 0;
+    size_t e = text.find_first_of("eE");
+    if (e != std::string_view::npos) {
+        std::string_view power = text.substr(e + 1);
+        if (!power.empty() && power.front() == '+') power.remove_prefix(1);
+        const char* last = power.data() + power.size();
+        auto result = std::from_chars(power.data(), last, exponent);
+        if (power.empty() || result.ec != std::errc() || result.ptr != last ||
+            exponent > kMaxExponent || exponent < -kMaxExponent) {
+            return false;
+        }
+        text = text.substr(0, e);
+    }
+
+    // Digits on either side of an optional point, at least one in all.
+    size_t point = text.find('.');
+    std::string_view whole = text.substr(0, point);
+    std::string_view fraction = point == std::string_view::npos ? std::string_view() : text.substr(point + 1);
+    if (whole.size() + fraction.size() == 0 || !allDigits(whole) || !allDigits(fraction)) return false;
+
+    std::string digits(whole);
+    digits += fraction;
+    BigInteger numerator;
+    if (!BigInteger::tryParse(digits, numerator)) return false;
+    if (negative) numerator = -numerator;
+
+    exponent -= static_cast<int>(fraction.size());
+    if (exponent < -kMaxExponent) return false;
+    if (exponent >= 0) {
+        out = Rational(numerator * powerOfTen(exponent));
+    } else {
+        out = Rational(std::move(numerator), powerOfTen(-exponent));
+    }
+    return true;
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include <concepts>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "BigInteger.h"
+
+// Exact fraction of BigIntegers, always in lowest terms with a positive
+// denominator, so equal values compare equal member by member. Integers
+// (denominator 1) skip the gcd work entirely, and with BigInteger's own int64
+// fast path integer-valued polynomial arithmetic costs a handful of checked
+// machine operations per coefficient.
+class Rational {
+public:
+    Rational() = default;
+
+    template<std::integral I>
+    Rational(I value) : num_(value) {}
+
+    Rational(BigInteger value) : num_(std::move(value)) {}
+
+    // Reduces; throws std::domain_error for a zero denominator.
+    Rational(BigInteger numerator, BigInteger denominator);
+
+    // "-7", "22/7", "3.25" or "1.5e-3"; false, leaving out unchanged, on
+    // anything else, including decimal exponents beyond kMaxExponent.
+    static bool tryParse(std::string_view text, Rational& out);
+    static constexpr int kMaxExponent = 4096;
+
+    const BigInteger& numerator() const { return num_; }
+    const BigInteger& denominator() const { return den_; }
+    bool isInteger() const { return den_.isOne(); }
+
+    explicit operator double() const;
+    // "n" for integers, "n/d" otherwise.
+    std::string toString() const;
+
+    Rational operator-() const {
+        Rational r;
+        r.num_ = -num_;
+        r.den_ = den_;
+        return r;
+    }
+
+    friend Rational operator+(const Rational& a, const Rational& b) {
+        if (a.isInteger() && b.isInteger()) return Rational(a.num_ + b.num_);
+        return addSlow(a, b, false);
+    }
+
+    friend Rational operator-(const Rational& a, const Rational& b) {
+        if (a.isInteger() && b.isInteger()) return Rational(a.num_ - b.num_);
+        return addSlow(a, b, true);
+    }
+
+    friend Rational operator*(const Rational& a, const Rational& b) {
+        if (a.isInteger() && b.isInteger()) return Rational(a.num_ * b.num_);
+        return multiplySlow(a, b);
+    }
+
+    // Throws std::domain_error on zero.
+    friend Rational operator/(const Rational& a, const Rational& b) {
+        return multiplySlow(a, b.reciprocal());
+    }
+
+    Rational reciprocal() const;
+
+    Rational& operator+=(const Rational& b) {
+        if (isInteger() && b.isInteger()) {
+            num_ += b.num_;
+            return *this;
+        }
+        return *this = addSlow(*this, b, false);
+    }
+    Rational& operator-=(const Rational& b) {
+        if (isInteger() && b.isInteger()) {
+            num_ -= b.num_;
+            return *this;
+        }
+        return *this = addSlow(*this, b, true);
+    }
+    Rational& operator*=(const Rational& b) {
+        if (isInteger() && b.isInteger()) {
+            num_ *= b.num_;
+            return *this;
+        }
+        return *this = multiplySlow(*this, b);
+    }
+    Rational& operator/=(const Rational& b) { return *this = *this / b; }
+
+    friend bool operator==(const Rational& a, const Rational& b) {
+        return a.num_ == b.num_ && a.den_ == b.den_;
+    }
+    friend bool operator!=(const Rational& a, const Rational& b) { return !(a == b); }
+    friend bool operator<(const Rational& a, const Rational& b) {
+        if (a.isInteger() && b.isInteger()) return a.num_ < b.num_;
+        return a.num_ * b.den_ < b.num_ * a.den_;
+    }
+    friend bool operator>(const Rational& a, const Rational& b) { return b < a; }
+    friend bool operator<=(const Rational& a, const Rational& b) { return !(b < a); }
+    friend bool operator>=(const Rational& a, const Rational& b) { return !(a < b); }
+
+    friend Rational abs(const Rational& a) { return a.num_.isNegative() ? -a : a; }
+
+    friend std::ostream& operator<<(std::ostream& os, const Rational& a) { return os << a.toString(); }
+
+private:
+    BigInteger num_;
+    BigInteger den_ = 1;
+
+    static Rational addSlow(const Rational& a, const Rational& b, bool subtract);
+    static Rational multiplySlow(const Rational& a, const Rational& b);
+};
+
+// Exact as well: PolynomialDivider's tolerances come out zero.
+template<>
+struct std::numeric_limits<Rational> {
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = true;
+    static constexpr bool is_bounded = false;
+    static constexpr int radix = 2;
+    static Rational epsilon() { return 0; }
+};
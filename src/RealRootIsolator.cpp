@@ -0,0 +1,201 @@
+#include "RealRootIsolator.h"
+#include <algorithm>
+#include <cmath>
+
+template<typename T>
+static int signOf(T v) {
+    return (v > 0) - (v < 0);
+}
+
+template<typename T>
+static T evaluateAscending(const std::vector<T>& c, T x) {
+    T acc = c.back();
+    for (size_t i = c.size() - 1; i-- > 0;) {
+        acc = acc * x + c[i];
+    }
+    return acc;
+}
+
+template<typename T>
+void RealRootIsolator<T>::normalize(std::vector<T>& coeffs) {
+    // Positive scaling leaves every sign, and so every Sturm count, unchanged.
+    T scale = 0;
+    for (T c : coeffs) scale = std::max(scale, std::abs(c));
+    if (scale > 0) {
+        for (T& c : coeffs) c /= scale;
+    }
+}
+
+template<typename T>
+std::vector<T> RealRootIsolator<T>::remainder(const std::vector<T>& num, const std::vector<T>& den) {
+    std::vector<T> r = PolynomialDivider<T>::remainder(num, den);
+
+    // Both inputs are normalized to max |c| = 1, so anything near the unit
+    // roundoff is cancellation noise rather than a real coefficient.
+    const T noise = T(64) * std::numeric_limits<T>::epsilon() * static_cast<T>(num.size());
+    while (!r.empty() && std::abs(r.back()) <= noise) r.pop_back();
+    return r;
+}
+
+template<typename T>
+RealRootIsolator<T>::RealRootIsolator(const Polynomial<T>& poly) : poly_(poly), bound_(0) {
+    auto coeffs = poly.coeffs();
+    std::vector<T> p0(coeffs.begin(), coeffs.end());
+    while (p0.size() > 1 && p0.back() == 0) p0.pop_back();
+    if (p0.size() == 1 && p0[0] == 0) {
+        throw SolverException("Cannot isolate the roots of the zero polynomial");
+    }
+
+    T lead = std::abs(p0.back());
+    T maxRatio = 0;
+    for (size_t i = 0; i + 1 < p0.size(); ++i) {
+        maxRatio = std::max(maxRatio, std::abs(p0[i]) / lead);
+    }
+    bound_ = 1 + maxRatio;
+
+    normalize(p0);
+    chain_.push_back(p0);
+    if (p0.size() == 1) return;
+
+    std::vector<T> p1(p0.size() - 1);
+    for (size_t i = 1; i < p0.size(); ++i) {
+        p1[i - 1] = p0[i] * static_cast<T>(i);
+    }
+    normalize(p1);
+    chain_.push_back(p1);
+
+    while (chain_.back().size() > 1) {
+        std::vector<T> r = remainder(chain_[chain_.size() - 2], chain_.back());
+        if (r.empty()) break;
+        for (T& c : r) c = -c;
+        normalize(r);
+        chain_.push_back(std::move(r));
+    }
+}
+
+template<typename T>
+int RealRootIsolator<T>::signChangesAt(T x) const {
+    int changes = 0;
+    int last = 0;
+    for (const auto& p : chain_) {
+        int s = signOf(evaluateAscending(p, x));
+        if (s == 0) continue;
+        if (last != 0 && s != last) ++changes;
+        last = s;
+    }
+    return changes;
+}
+
+template<typename T>
+int RealRootIsolator<T>::signChangesAtInfinity(bool negative) const {
+    int changes = 0;
+    int last = 0;
+    for (const auto& p : chain_) {
+        int s = signOf(p.back());
+        if (negative && (p.size() - 1) % 2 == 1) s = -s;
+        if (last != 0 && s != last) ++changes;
+        last = s;
+    }
+    return changes;
+}
+
+template<typename T>
+int RealRootIsolator<T>::countRealRootsIn(T a, T b) const {
+    if (!(a < b)) return 0;
+    return signChangesAt(a) - signChangesAt(b);
+}
+
+template<typename T>
+int RealRootIsolator<T>::countRealRoots() const {
+    return signChangesAtInfinity(true) - signChangesAtInfinity(false);
+}
+
+template<typename T>
+void RealRootIsolator<T>::isolate(T a, T b, int count, int depth, std::vector<Interval>& out) const {
+    if (count <= 0) return;
+    // A cluster tighter than the working precision cannot be separated further.
+    bool unresolvable = depth > std::numeric_limits<T>::digits + 64 ||
+                        b - a <= std::numeric_limits<T>::epsilon() * std::max(std::abs(a), std::abs(b));
+    if (count == 1 || unresolvable) {
+        out.push_back({ a, b });
+        return;
+    }
+
+    T mid = a + (b - a) / 2;
+    int left = countRealRootsIn(a, mid);
+    isolate(a, mid, left, depth + 1, out);
+    isolate(mid, b, count - left, depth + 1, out);
+}
+
+template<typename T>
+std::vector<typename RealRootIsolator<T>::Interval> RealRootIsolator<T>::isolate() const {
+    std::vector<Interval> intervals;
+    if (chain_.front().size() <= 1) return intervals;
+
+    T a = -bound_;
+    T b = bound_;
+    isolate(a, b, countRealRootsIn(a, b), 0, intervals);
+    return intervals;
+}
+
+template<typename T>
+T RealRootIsolator<T>::refine(const Interval& interval, T tolerance) const {
+    T lo = interval.lower;
+    T hi = interval.upper;
+    // Compensated, so the sign at an endpoint close to the root is right.
+    T flo = poly_.evaluate(lo, EvaluationMode::Compensated);
+    T fhi = poly_.evaluate(hi, EvaluationMode::Compensated);
+    if (fhi == 0) return hi;
+
+    if (signOf(flo) == signOf(fhi)) {
+        // Even multiplicity: p touches zero without crossing, so keep halving
+        // with the Sturm count, which still sees the root.
+        while (hi - lo > tolerance * std::max(T(1), std::abs(hi))) {
+            T mid = lo + (hi - lo) / 2;
+            if (mid <= lo || mid >= hi) break;
+            if (countRealRootsIn(lo, mid) > 0) hi = mid;
+            else lo = mid;
+        }
+        return lo + (hi - lo) / 2;
+    }
+
+    // Newton from the midpoint, kept inside the sign-change bracket; a step
+    // that leaves the bracket or fails to halve it becomes a bisection.
+    if (flo > 0) std::swap(lo, hi);
+    T x = interval.lower + (interval.upper - interval.lower) / 2;
+    T dxOld = std::abs(interval.upper - interval.lower);
+    T dx = dxOld;
+    auto d = poly_.evaluateDerivatives(x);
+    for (int iter = 0; iter < 200; ++iter) {
+        bool outside = ((x - hi) * d.first - d.value) * ((x - lo) * d.first - d.value) > 0;
+        if (outside || std::abs(2 * d.value) > std::abs(dxOld * d.first)) {
+            dxOld = dx;
+            dx = (hi - lo) / 2;
+            x = lo + dx;
+        } else {
+            dxOld = dx;
+            dx = d.value / d.first;
+            x -= dx;
+        }
+        if (std::abs(dx) <= tolerance * std::max(T(1), std::abs(x))) break;
+
+        d = poly_.evaluateDerivatives(x);
+        if (d.value == 0) break;
+        if (d.value < 0) lo = x;
+        else hi = x;
+    }
+    return x;
+}
+
+template<typename T>
+std::vector<T> RealRootIsolator<T>::solve(T tolerance) const {
+    std::vector<T> roots;
+    for (const auto& interval : isolate()) {
+        roots.push_back(refine(interval, tolerance));
+    }
+    return roots;
+}
+
+template class RealRootIsolator<float>;
+template class RealRootIsolator<double>;
+template class RealRootIsolator<long double>;
@@ -0,0 +1,42 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include "Polynomial.h"
+#include "PolynomialDivider.h"
+#include "Exceptions.h"
+
+// Real roots only: a Sturm chain gives the number of distinct real roots in
+// any interval, which is used to split the Cauchy bound into disjoint
+// isolating intervals before each root is polished by safeguarded Newton.
+template<typename T>
+class RealRootIsolator {
+public:
+    struct Interval {
+        T lower;  // exclusive
+        T upper;  // inclusive
+    };
+
+    explicit RealRootIsolator(const Polynomial<T>& poly);
+
+    // Distinct real roots in (a, b].
+    int countRealRootsIn(T a, T b) const;
+    int countRealRoots() const;
+
+    std::vector<Interval> isolate() const;
+
+    // One value per distinct real root, ascending.
+    std::vector<T> solve(T tolerance = std::numeric_limits<T>::epsilon() * 16) const;
+
+private:
+    int signChangesAt(T x) const;
+    int signChangesAtInfinity(bool negative) const;
+    void isolate(T a, T b, int count, int depth, std::vector<Interval>& out) const;
+    T refine(const Interval& interval, T tolerance) const;
+
+    static std::vector<T> remainder(const std::vector<T>& num, const std::vector<T>& den);
+    static void normalize(std::vector<T>& coeffs);
+
+    Polynomial<T> poly_;
+    std::vector<std::vector<T>> chain_;
+    T bound_;
+};
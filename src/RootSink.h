@@ -0,0 +1,32 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <span>
+
+// Receives each root as soon as it settles, with its relativeResidual. Runs on
+// the solving thread; parallel solves call it from one thread at a time.
+template<typename T>
+using RootSink = std::function<void(const std::complex<T>& root, T residual)>;
+
+// |p(z)| / sum |a_i| |z|^i, the backward error of z as a root of p. Outside
+// the unit disc the reversed polynomial is evaluated at 1/z, so large roots
+// of high-degree polynomials do not overflow. C is T or std::complex<T>.
+template<typename T, typename C>
+T relativeResidual(std::span<const C> coeffs, std::complex<T> z) {
+    if (coeffs.empty()) return T(0);
+
+    const std::size_t n = coeffs.size() - 1;
+    const bool outside = std::abs(z) > T(1);
+    const std::complex<T> x = outside ? std::complex<T>(1) / z : z;
+    const T ax = std::abs(x);
+
+    std::complex<T> value = 0;
+    T bound = 0;
+    for (std::size_t i = 0; i <= n; ++i) {
+        const C& a = coeffs[outside ? i : n - i];
+        value = value * x + a;
+        bound = bound * ax + std::abs(a);
+    }
+    return bound > 0 ? std::abs(value) / bound : T(0);
+}
@@ -0,0 +1,199 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+// Contiguous storage that keeps up to InlineCapacity elements inside the object
+// and spills to the supplied memory_resource beyond that.
+template<typename T, std::size_t InlineCapacity = 8>
+class SmallVector {
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    explicit SmallVector(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : data_(inlineData()), size_(0), capacity_(InlineCapacity), resource_(resource) {}
+
+    SmallVector(std::size_t count, const T& value,
+                std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : SmallVector(resource) {
+        reserve(count);
+        std::uninitialized_fill_n(data_, count, value);
+        size_ = count;
+    }
+
+    SmallVector(const T* first, std::size_t count,
+                std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : SmallVector(resource) {
+        reserve(count);
+        std::uninitialized_copy_n(first, count, data_);
+        size_ = count;
+    }
+
+    SmallVector(const SmallVector& other)
+        : SmallVector(other.data_, other.size_) {}
+
+    SmallVector(const SmallVector& other, std::pmr::memory_resource* resource)
+        : SmallVector(other.data_, other.size_, resource) {}
+
+    SmallVector(SmallVector&& other) noexcept
+        : SmallVector(other.resource_) {
+        takeFrom(other);
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            std::uninitialized_copy_n(other.data_, other.size_, data_);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    // Steals the buffer only when both sides use the same resource; otherwise
+    // moves the elements into this one's storage, which may allocate and
+    // throw, so unlike the move constructor this is not noexcept (as with
+    // std::pmr::vector).
+    SmallVector& operator=(SmallVector&& other) {
+        if (this != &other) {
+            clear();
+            if (!other.isInline() && *resource_ == *other.resource_) {
+                release();
+                takeFrom(other);
+            } else {
+                reserve(other.size_);
+                std::uninitialized_move_n(other.data_, other.size_, data_);
+                size_ = other.size_;
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        clear();
+        release();
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    std::size_t capacity() const { return capacity_; }
+    bool isInline() const { return data_ == inlineData(); }
+    std::pmr::memory_resource* resource() const { return resource_; }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    T& operator[](std::size_t i) { return data_[i]; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+    T& front() { return data_[0]; }
+    const T& front() const { return data_[0]; }
+    T& back() { return data_[size_ - 1]; }
+    const T& back() const { return data_[size_ - 1]; }
+
+    iterator begin() { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+
+    void reserve(std::size_t count) {
+        if (count <= capacity_) return;
+
+        T* fresh = static_cast<T*>(resource_->allocate(count * sizeof(T), alignof(T)));
+        std::uninitialized_move_n(data_, size_, fresh);
+        std::destroy_n(data_, size_);
+        release();
+        data_ = fresh;
+        capacity_ = count;
+    }
+
+    void resize(std::size_t count) {
+        if (count < size_) {
+            std::destroy(data_ + count, data_ + size_);
+        } else if (count > size_) {
+            reserve(count);
+            std::uninitialized_value_construct(data_ + size_, data_ + count);
+        }
+        size_ = count;
+    }
+
+    void push_back(const T& value) {
+        if (size_ == capacity_) return growAndAppend(value);
+        ::new (static_cast<void*>(data_ + size_)) T(value);
+        ++size_;
+    }
+
+    void push_back(T&& value) {
+        if (size_ == capacity_) return growAndAppend(std::move(value));
+        ::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+        ++size_;
+    }
+
+    void pop_back() {
+        --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    void clear() {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+
+private:
+    T* inlineData() { return std::launder(reinterpret_cast<T*>(inline_)); }
+    const T* inlineData() const { return std::launder(reinterpret_cast<const T*>(inline_)); }
+
+    void release() {
+        if (!isInline()) {
+            resource_->deallocate(data_, capacity_ * sizeof(T), alignof(T));
+            data_ = inlineData();
+            capacity_ = InlineCapacity;
+        }
+    }
+
+    // Builds the new element in the doubled buffer before the old one is
+    // released, as std::vector does, so v.push_back(v[0]) reads live memory.
+    template<typename U>
+    void growAndAppend(U&& value) {
+        const std::size_t count = capacity_ * 2;
+        T* fresh = static_cast<T*>(resource_->allocate(count * sizeof(T), alignof(T)));
+        try {
+            ::new (static_cast<void*>(fresh + size_)) T(std::forward<U>(value));
+        } catch (...) {
+            resource_->deallocate(fresh, count * sizeof(T), alignof(T));
+            throw;
+        }
+        std::uninitialized_move_n(data_, size_, fresh);
+        std::destroy_n(data_, size_);
+        release();
+        data_ = fresh;
+        capacity_ = count;
+        ++size_;
+    }
+
+    // Expects *this to be empty and inline.
+    void takeFrom(SmallVector& other) {
+        if (other.isInline()) {
+            std::uninitialized_move_n(other.data_, other.size_, data_);
+            size_ = other.size_;
+            other.clear();
+        } else {
+            resource_ = other.resource_;
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0;
+            other.capacity_ = InlineCapacity;
+        }
+    }
+
+    T* data_;
+    std::size_t size_;
+    std::size_t capacity_;
+    std::pmr::memory_resource* resource_;
+    alignas(T) unsigned char inline_[sizeof(T) * InlineCapacity];
+};
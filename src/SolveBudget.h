@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+enum class SolveStatus {
+    Converged,        // every root met the tolerance
+    IterationLimit,   // maxIterations ran out first
+    DeadlineExceeded,
+    Cancelled
+};
+
+inline const char* solveStatusName(SolveStatus status) {
+    switch (status) {
+        case SolveStatus::Converged: return "converged";
+        case SolveStatus::IterationLimit: return "iteration limit reached";
+        case SolveStatus::DeadlineExceeded: return "deadline exceeded";
+        case SolveStatus::Cancelled: return "cancelled";
+    }
+    return "unknown";
+}
+
+// Limits on a single solve, polled between sweeps (Aberth) or every few
+// dozen steps (Newton). The flag and counter belong to the caller and must
+// outlive the solve.
+struct SolveBudget {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point deadline = Clock::time_point::max();
+    const std::atomic<bool>* cancelled = nullptr;
+    std::atomic<std::size_t>* progress = nullptr;  // roots settled so far
+
+    static SolveBudget within(Clock::duration limit) {
+        SolveBudget budget;
+        budget.deadline = Clock::now() + limit;
+        return budget;
+    }
+
+    // Why the solve has to stop now, if it does.
+    std::optional<SolveStatus> interruption() const {
+        if (cancelled && cancelled->load(std::memory_order_relaxed)) return SolveStatus::Cancelled;
+        if (deadline != Clock::time_point::max() && Clock::now() >= deadline) return SolveStatus::DeadlineExceeded;
+        return std::nullopt;
+    }
+
+    void report(std::size_t settled) const {
+        if (progress) progress->store(settled, std::memory_order_relaxed);
+    }
+};
+
+// roots[0, converged) met the tolerance; the rest are the latest estimates
+// of roots the solve did not finish. A multiplicity-aware solve lists each
+// distinct root once and fills multiplicities in step with roots; otherwise
+// it is empty and repeated roots appear repeatedly.
+template<typename T>
+struct SolveResult {
+    std::vector<std::complex<T>> roots;
+    std::vector<int> multiplicities;
+    std::size_t converged = 0;
+    SolveStatus status = SolveStatus::Converged;
+    int iterations = 0;
+
+    bool complete() const { return status == SolveStatus::Converged; }
+    int multiplicity(std::size_t i) const { return multiplicities.empty() ? 1 : multiplicities[i]; }
+};
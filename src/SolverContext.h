@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+#include "Polynomial.h"
+
+// Non-owning view of ascending coefficients that satisfies PolynomialLike, so
+// Newton can iterate on a scratch buffer while deflation shrinks it.
+template<typename T>
+class CoefficientView {
+public:
+    using value_type = T;
+    using Derivatives = typename Polynomial<T>::Derivatives;
+
+    explicit CoefficientView(std::span<const T> coeffs) : coeffs_(coeffs) {}
+
+    int degree() const { return static_cast<int>(coeffs_.size()) - 1; }
+
+    T evaluate(T x) const { return evaluateDerivatives(x).value; }
+
+    Derivatives evaluateDerivatives(T x, bool withSecond = false) const {
+        return Polynomial<T>::evaluateDerivatives(coeffs_, x, withSecond);
+    }
+
+    std::span<const T> coeffs() const { return coeffs_; }
+
+private:
+    std::span<const T> coeffs_;
+};
+
+// Per-solve state for the Newton engine: a seeded generator for starting
+// guesses and buffers that keep their capacity between solves. Not shared
+// across threads; use forThisThread() or one context per worker.
+template<typename T>
+class SolverContext {
+public:
+    static constexpr std::uint64_t kDefaultSeed = 0x9E3779B97F4A7C15ull;
+
+    explicit SolverContext(std::uint64_t seed = kDefaultSeed) : seed_(seed), rng_(seed) {}
+
+    std::uint64_t seed() const { return seed_; }
+
+    void reseed(std::uint64_t seed) {
+        seed_ = seed;
+        rng_.seed(seed);
+    }
+
+    // Rewinds the generator so a solve depends only on its input and the seed.
+    void restart() { rng_.seed(seed_); }
+
+    // Newton starting point, uniform on [-10, 10).
+    T nextGuess() {
+        return static_cast<T>(std::uniform_real_distribution<double>(-10.0, 10.0)(rng_));
+    }
+
+    // Copies coeffs into the deflation buffer; no allocation once it is large enough.
+    std::span<T> loadScratch(std::span<const T> coeffs) {
+        scratch_.assign(coeffs.begin(), coeffs.end());
+        return scratch_;
+    }
+
+    std::vector<T>& roots() { return roots_; }
+
+    // One context per thread, seeded with kDefaultSeed.
+    static SolverContext& forThisThread() {
+        thread_local SolverContext context;
+        return context;
+    }
+
+private:
+    std::uint64_t seed_;
+    std::mt19937_64 rng_;
+    std::vector<T> scratch_;
+    std::vector<T> roots_;
+};
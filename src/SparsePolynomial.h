@@ -0,0 +1,172 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "CoefficientParser.h"
+#include "Exceptions.h"
+#include "Polynomial.h"
+
+// (exponent, coefficient) pairs for inputs like x^10000 - 1: storage, parsing
+// and evaluation scale with the number of terms rather than the degree. Terms
+// are kept ascending by exponent with no zero coefficients, so the zero
+// polynomial has none. The solvers work on the dense form from toDense().
+template<typename T>
+class SparsePolynomial {
+public:
+    using value_type = T;
+    using Term = SparseTerm<T>;
+
+    SparsePolynomial() = default;
+
+    // Terms in any order; like exponents are summed and zeros dropped.
+    explicit SparsePolynomial(std::vector<Term> terms) : terms_(std::move(terms)) {
+        for (const auto& term : terms_) {
+            if (term.exponent < 0) {
+                throw InvalidPolynomialException("Negative exponent: " + std::to_string(term.exponent));
+            }
+        }
+        std::sort(terms_.begin(), terms_.end(),
+                  [](const Term& a, const Term& b) { return a.exponent < b.exponent; });
+        size_t out = 0;
+        for (size_t i = 0; i < terms_.size(); ++i) {
+            if (out > 0 && terms_[out - 1].exponent == terms_[i].exponent) {
+                terms_[out - 1].coefficient += terms_[i].coefficient;
+            } else {
+                terms_[out++] = terms_[i];
+            }
+        }
+        terms_.resize(out);
+        std::erase_if(terms_, [](const Term& term) { return term.coefficient == T(0); });
+    }
+
+    static SparsePolynomial fromDense(const Polynomial<T>& poly) {
+        std::vector<Term> terms;
+        auto coeffs = poly.coeffs();
+        for (size_t i = 0; i < coeffs.size(); ++i) {
+            if (coeffs[i] != T(0)) terms.push_back({ static_cast<int>(i), coeffs[i] });
+        }
+        SparsePolynomial result;
+        result.terms_ = std::move(terms);
+        return result;
+    }
+
+    Polynomial<T> toDense(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const {
+        typename Polynomial<T>::Storage coeffs(resource);
+        coeffs.resize(static_cast<size_t>(degree()) + 1);
+        for (const auto& term : terms_) coeffs[term.exponent] = term.coefficient;
+        return Polynomial<T>(std::move(coeffs));
+    }
+
+    int degree() const {
+        return terms_.empty() ? 0 : terms_.back().exponent;
+    }
+
+    // Number of non-zero terms.
+    size_t size() const {
+        return terms_.size();
+    }
+
+    std::span<const Term> terms() const {
+        return terms_;
+    }
+
+    // Horner over the terms, with each gap between exponents bridged by
+    // squaring: O(terms * log(degree)) multiplications.
+    T evaluate(T x) const {
+        if (terms_.empty()) return 0;
+        T result = 0;
+        int previous = terms_.back().exponent;
+        for (size_t i = terms_.size(); i-- > 0;) {
+            result = result * power(x, previous - terms_[i].exponent) + terms_[i].coefficient;
+            previous = terms_[i].exponent;
+        }
+        return result * power(x, previous);
+    }
+
+    SparsePolynomial derivative() const {
+        SparsePolynomial result;
+        for (const auto& term : terms_) {
+            if (term.exponent > 0) {
+                result.terms_.push_back({ term.exponent - 1, term.coefficient * static_cast<T>(term.exponent) });
+            }
+        }
+        return result;
+    }
+
+    std::string toString() const {
+        if (terms_.empty()) return "0";
+
+        std::ostringstream oss;
+        for (size_t k = terms_.size(); k-- > 0;) {
+            const int i = terms_[k].exponent;
+            const T coeff = terms_[k].coefficient;
+
+            if (k + 1 < terms_.size()) {
+                oss << (coeff > 0 ? " + " : " - ");
+            } else if (coeff < 0) {
+                oss << "-";
+            }
+
+            using std::abs;
+            T absCoeff = abs(coeff);
+
+            if (i == 0) {
+                oss << absCoeff;
+            } else if (i == 1) {
+                if (absCoeff != 1) oss << absCoeff;
+                oss << "x";
+            } else {
+                if (absCoeff != 1) oss << absCoeff;
+                oss << "x^" << i;
+            }
+        }
+
+        return oss.str();
+    }
+
+    // coefficient@exponent terms or a plain dense list; see
+    // CoefficientParser::parseTermsInto.
+    static SparsePolynomial parse(std::string_view str) {
+        ParseError error;
+        auto poly = tryParse(str, &error);
+        if (!poly) {
+            if (error.code == ParseErrorCode::NoCoefficients) {
+                throw InvalidPolynomialException("No coefficients found");
+            }
+            if (error.code == ParseErrorCode::InvalidExponent) {
+                throw InvalidPolynomialException("Invalid exponent: " + std::string(error.token));
+            }
+            if (error.code == ParseErrorCode::OutOfRange && CoefficientParser<T>::isExponentError(str, error)) {
+                throw InvalidPolynomialException("Exponent too large: " + std::string(error.token));
+            }
+            throw InvalidPolynomialException("Invalid coefficient: " + std::string(error.token));
+        }
+        return std::move(*poly);
+    }
+
+    static std::optional<SparsePolynomial> tryParse(std::string_view str, ParseError* error = nullptr) {
+        std::vector<Term> terms;
+        ParseError result = CoefficientParser<T>::parseTermsInto(str, terms);
+        if (error) *error = result;
+        if (result) return std::nullopt;
+        return SparsePolynomial(std::move(terms));
+    }
+
+private:
+    std::vector<Term> terms_;
+
+    static T power(T x, int exponent) {
+        T result = 1;
+        for (; exponent > 0; exponent >>= 1) {
+            if (exponent & 1) result *= x;
+            x *= x;
+        }
+        return result;
+    }
+};
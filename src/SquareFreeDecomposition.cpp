@@ -0,0 +1,98 @@
+#include "SquareFreeDecomposition.h"
+#include <algorithm>
+
+template<typename T>
+T SquareFreeDecomposition<T>::maxAbs(const Coeffs& c) {
+    T scale = 0;
+    for (T v : c) scale = std::max(scale, std::abs(v));
+    return scale;
+}
+
+template<typename T>
+void SquareFreeDecomposition<T>::trim(Coeffs& c, T tolerance, T scale) {
+    while (!c.empty() && std::abs(c.back()) <= tolerance * scale) c.pop_back();
+}
+
+template<typename T>
+void SquareFreeDecomposition<T>::normalize(Coeffs& c) {
+    T scale = maxAbs(c);
+    if (scale > 0) {
+        for (T& v : c) v /= scale;
+    }
+}
+
+template<typename T>
+void SquareFreeDecomposition<T>::makeMonic(Coeffs& c) {
+    T lead = c.back();
+    for (T& v : c) v /= lead;
+}
+
+template<typename T>
+typename SquareFreeDecomposition<T>::Coeffs
+SquareFreeDecomposition<T>::derivative(const Coeffs& c) {
+    if (c.size() <= 1) return { T(0) };
+    Coeffs d(c.size() - 1);
+    for (size_t i = 1; i < c.size(); ++i) {
+        d[i - 1] = c[i] * static_cast<T>(i);
+    }
+    return d;
+}
+
+template<typename T>
+typename SquareFreeDecomposition<T>::Coeffs
+SquareFreeDecomposition<T>::difference(const Coeffs& a, const Coeffs& b) {
+    Coeffs d(std::max(a.size(), b.size()), T(0));
+    for (size_t i = 0; i < a.size(); ++i) d[i] += a[i];
+    for (size_t i = 0; i < b.size(); ++i) d[i] -= b[i];
+    return d;
+}
+
+template<typename T>
+std::vector<typename SquareFreeDecomposition<T>::Factor>
+SquareFreeDecomposition<T>::decompose(const Polynomial<T>& poly, T tolerance) {
+    auto asc = poly.coeffs();
+    Coeffs f(asc.begin(), asc.end());
+    while (f.size() > 1 && f.back() == 0) f.pop_back();
+    if (f.size() == 1 && f[0] == 0) {
+        throw SolverException("Cannot factor the zero polynomial");
+    }
+
+    std::vector<Factor> factors;
+    if (f.size() == 1) return factors;
+    normalize(f);
+
+    using Divider = PolynomialDivider<T>;
+    Coeffs df = derivative(f);
+    Coeffs a = Divider::gcd(f, df, tolerance);
+    Coeffs b = Divider::quotient(f, a);
+    Coeffs c = Divider::quotient(df, a);
+    Coeffs d = difference(c, derivative(b));
+
+    const int degree = static_cast<int>(f.size()) - 1;
+    for (int multiplicity = 1; b.size() > 1; ++multiplicity) {
+        if (multiplicity > degree) {
+            // Rounding kept the GCDs from ever splitting b off; a single
+            // factor is still a correct, if unhelpful, answer.
+            makeMonic(f);
+            return { Factor{ Polynomial<T>(f), 1 } };
+        }
+        // d = c - b' is a difference of comparable terms, so it is zero when
+        // it is small next to them, however large it is next to itself.
+        trim(d, tolerance, std::max(maxAbs(c), maxAbs(derivative(b))));
+        a = d.empty() ? b : Divider::gcd(b, d, tolerance);
+        if (a.size() > 1) {
+            makeMonic(a);
+            factors.push_back({ Polynomial<T>(a), multiplicity });
+        }
+
+        Coeffs nextB = Divider::quotient(b, a);
+        c = d.empty() ? Coeffs{ T(0) } : Divider::quotient(d, a);
+        b = std::move(nextB);
+        d = difference(c, derivative(b));
+    }
+    return factors;
+}
+
+template class SquareFreeDecomposition<float>;
+template class SquareFreeDecomposition<double>;
+template class SquareFreeDecomposition<long double>;
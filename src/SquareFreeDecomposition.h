@@ -0,0 +1,39 @@
+#pragma once
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "Polynomial.h"
+#include "PolynomialDivider.h"
+#include "Exceptions.h"
+
+// Yun's algorithm: splits p into pairwise coprime square-free factors f_i with
+// p = lead * prod f_i^i, using only GCDs with derivatives and exact division.
+// Each factor has simple roots, so Newton and Aberth converge quadratically on
+// it, and the exponent is the multiplicity of every root of that factor.
+template<typename T>
+class SquareFreeDecomposition {
+public:
+    struct Factor {
+        Polynomial<T> poly;  // monic, square-free
+        int multiplicity;
+    };
+
+    // Remainder coefficients below tolerance * (largest coefficient) count
+    // as zero in the floating-point GCDs.
+    static std::vector<Factor> decompose(const Polynomial<T>& poly,
+                                         T tolerance = defaultTolerance());
+
+    static T defaultTolerance() { return PolynomialDivider<T>::defaultTolerance(); }
+
+private:
+    using Coeffs = std::vector<T>;
+
+    static Coeffs derivative(const Coeffs& c);
+    static Coeffs difference(const Coeffs& a, const Coeffs& b);
+
+    // Drops leading coefficients at or below tolerance * scale.
+    static void trim(Coeffs& c, T tolerance, T scale);
+    static T maxAbs(const Coeffs& c);
+    static void normalize(Coeffs& c);
+    static void makeMonic(Coeffs& c);
+};
@@ -0,0 +1,219 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Exceptions.h"
+#include "Polynomial.h"
+#include "PolynomialDivider.h"
+
+// Products of (x - x_i) over a fixed set of points, paired up level by level:
+// the leaves cover blocks of kLeafSize points and the root is the product
+// over all of them. Going down the tree by remainders evaluates a polynomial
+// at every point, and going up by cross products interpolates, each in
+// O(M(n) log^2 n) with M from PolynomialMultiplier.
+//
+// The remainders are taken in the monomial basis, so accuracy rests on the
+// subproducts having modest coefficients. Points are dealt to the leaves in
+// bit-reversed order, so sorted reals or consecutive roots of unity give
+// every subtree points from across the whole set. Points spread around a
+// circle then stay accurate into the thousands; real points lose digits
+// from a few dozen on (bench section "multipoint").
+template<typename T>
+class SubproductTree {
+public:
+    // Leaves are this many points, handled by Horner and O(b^2) Lagrange.
+    static constexpr std::size_t kLeafSize = 32;
+    // evaluate(poly, points, out) uses Horner below this many points, where
+    // building the tree costs more than it saves. A tree kept and reused
+    // for one point set is ahead from about 1024.
+    static constexpr std::size_t kTreeThreshold = 4096;
+
+    explicit SubproductTree(std::span<const T> points) {
+        if (points.empty()) {
+            throw InvalidPolynomialException("Subproduct tree needs at least one point");
+        }
+        std::size_t bits = 0;
+        while ((std::size_t(1) << bits) < points.size()) ++bits;
+        for (std::size_t i = 0; i < (std::size_t(1) << bits); ++i) {
+            std::size_t reversed = 0;
+            for (std::size_t b = 0; b < bits; ++b) reversed |= ((i >> b) & 1) << (bits - 1 - b);
+            if (reversed < points.size()) order_.push_back(reversed);
+        }
+        for (std::size_t index : order_) points_.push_back(points[index]);
+
+        std::vector<Polynomial<T>> leaves;
+        for (std::size_t begin = 0; begin < points_.size(); begin += kLeafSize) {
+            leaves.push_back(productOf(blockPoints(begin)));
+        }
+        levels_.push_back(std::move(leaves));
+        while (levels_.back().size() > 1) {
+            const auto& below = levels_.back();
+            std::vector<Polynomial<T>> above;
+            for (std::size_t i = 0; i < below.size(); i += 2) {
+                above.push_back(i + 1 < below.size() ? monicProduct(below[i], below[i + 1]) : below[i]);
+            }
+            levels_.push_back(std::move(above));
+        }
+
+        // Every descent divides by the same nodes, so the large ones keep the
+        // series Newton division would otherwise recompute each time. A
+        // node's remainders are shorter than its parent, which bounds the
+        // quotients.
+        inverses_.resize(levels_.size());
+        for (std::size_t level = 0; level + 1 < levels_.size(); ++level) {
+            inverses_[level].resize(levels_[level].size());
+            for (std::size_t i = 0; i < levels_[level].size(); ++i) {
+                const auto node = levels_[level][i].coeffs();
+                const std::size_t quotient = static_cast<std::size_t>(levels_[level + 1][i / 2].degree()) - (node.size() - 1);
+                if (std::min(quotient, node.size()) >= PolynomialDivider<T>::kNewtonThreshold) {
+                    inverses_[level][i] = PolynomialDivider<T>::reversedReciprocal(node, quotient);
+                }
+            }
+        }
+    }
+
+    std::size_t size() const {
+        return points_.size();
+    }
+
+    // prod (x - x_i) over all the points.
+    const Polynomial<T>& root() const {
+        return levels_.back().front();
+    }
+
+    // out[i] = poly(x_i), in the order the points were given.
+    void evaluate(const Polynomial<T>& poly, std::span<T> out) const {
+        if (out.size() < points_.size()) {
+            throw InvalidPolynomialException("Output span is smaller than the point set");
+        }
+        std::vector<T> values(points_.size());
+        const Polynomial<T>& top = root();
+        descend(levels_.size() - 1, 0, poly.degree() >= top.degree() ? poly % top : poly, values);
+        for (std::size_t k = 0; k < order_.size(); ++k) out[order_[k]] = values[k];
+    }
+
+    // The polynomial of degree below size() through (x_i, values[i]); the
+    // points must be distinct.
+    Polynomial<T> interpolate(std::span<const T> values) const {
+        if (values.size() != points_.size()) {
+            throw InvalidPolynomialException("Interpolation needs one value per point");
+        }
+        // Lagrange weights: y_i / M'(x_i) with M the root product.
+        std::vector<T> weights(points_.size());
+        std::vector<T> derivative(points_.size());
+        evaluate(root().derivative(), derivative);
+        for (std::size_t k = 0; k < order_.size(); ++k) {
+            const T slope = derivative[order_[k]];
+            if (slope == T(0)) {
+                throw InvalidPolynomialException("Interpolation points must be distinct");
+            }
+            weights[k] = values[order_[k]] / slope;
+        }
+        return ascend(levels_.size() - 1, 0, weights);
+    }
+
+    // Horner below kTreeThreshold points, and for real points at any count:
+    // their subproducts are too ill-conditioned for the tree to be accurate.
+    static void evaluate(const Polynomial<T>& poly, std::span<const T> points, std::span<T> out) {
+        if (std::is_floating_point_v<T> || points.size() < kTreeThreshold) {
+            poly.evaluateMany(points, out);
+        } else {
+            SubproductTree(points).evaluate(poly, out);
+        }
+    }
+
+private:
+    // The points in leaf order; points_[k] is caller's point order_[k].
+    std::vector<T> points_;
+    std::vector<std::size_t> order_;
+    // levels_[0] are the leaves; node i of a level has children 2i and 2i + 1
+    // one level down, or just 2i when it was carried up unpaired.
+    std::vector<std::vector<Polynomial<T>>> levels_;
+    // inverses_[level][i]: reversedReciprocal of levels_[level][i], or empty
+    // where long division is the faster choice.
+    std::vector<std::vector<std::vector<T>>> inverses_;
+
+    std::span<const T> blockPoints(std::size_t begin) const {
+        return std::span<const T>(points_).subspan(begin, std::min(kLeafSize, points_.size() - begin));
+    }
+
+    // First point and count of the points under a node.
+    std::pair<std::size_t, std::size_t> range(std::size_t level, std::size_t index) const {
+        const std::size_t leaves = std::size_t(1) << level;
+        const std::size_t begin = index * leaves * kLeafSize;
+        const std::size_t end = std::min(points_.size(), (index + 1) * leaves * kLeafSize);
+        return { begin, end - begin };
+    }
+
+    static Polynomial<T> productOf(std::span<const T> points) {
+        std::vector<T> asc(points.size() + 1, T(0));
+        asc[0] = T(1);
+        for (std::size_t k = 0; k < points.size(); ++k) {
+            // Multiply the k + 1 coefficients so far by (x - points[k]).
+            for (std::size_t i = k + 1; i > 0; --i) asc[i] = asc[i - 1] - points[k] * asc[i];
+            asc[0] = -points[k] * asc[0];
+        }
+        return Polynomial<T>(asc);
+    }
+
+    // The leading 1 is exact; an FFT product would carry it only to within
+    // rounding of the largest coefficient, and could even lose it.
+    static Polynomial<T> monicProduct(const Polynomial<T>& a, const Polynomial<T>& b) {
+        Polynomial<T> product = a * b;
+        std::vector<T> coeffs(product.coeffs().begin(), product.coeffs().end());
+        coeffs.back() = T(1);
+        return Polynomial<T>(coeffs);
+    }
+
+    void descend(std::size_t level, std::size_t index, const Polynomial<T>& remainder, std::span<T> out) const {
+        if (level == 0) {
+            auto [begin, count] = range(0, index);
+            remainder.evaluateMany(std::span<const T>(points_).subspan(begin, count), out.subspan(begin, count));
+            return;
+        }
+        const auto& below = levels_[level - 1];
+        for (std::size_t child = 2 * index; child < std::min(2 * index + 2, below.size()); ++child) {
+            descend(level - 1, child, reduce(remainder, level - 1, child), out);
+        }
+    }
+
+    // remainder mod levels_[level][index].
+    Polynomial<T> reduce(const Polynomial<T>& remainder, std::size_t level, std::size_t index) const {
+        const Polynomial<T>& node = levels_[level][index];
+        if (remainder.degree() < node.degree()) return remainder;
+        const auto& inverse = inverses_[level][index];
+        if (inverse.empty()) return remainder % node;
+
+        std::vector<T> q(static_cast<std::size_t>(remainder.degree() - node.degree()) + 1);
+        std::vector<T> r(static_cast<std::size_t>(node.degree()));
+        PolynomialDivider<T>::divide(remainder.coeffs(), node.coeffs(), inverse, q, r);
+        return Polynomial<T>(r);
+    }
+
+    // sum over the node's points of weights[i] * (node product) / (x - x_i).
+    Polynomial<T> ascend(std::size_t level, std::size_t index, std::span<const T> weights) const {
+        if (level == 0) {
+            auto [begin, count] = range(0, index);
+            const auto product = levels_[0][index].coeffs();
+            std::vector<T> sum(count, T(0));
+            std::vector<T> quotient(count);
+            for (std::size_t i = begin; i < begin + count; ++i) {
+                // Synthetic division of the leaf product by (x - x_i).
+                T carry = T(0);
+                for (std::size_t k = count; k-- > 0;) {
+                    carry = product[k + 1] + points_[i] * carry;
+                    quotient[k] = carry;
+                }
+                for (std::size_t k = 0; k < count; ++k) sum[k] += weights[i] * quotient[k];
+            }
+            return Polynomial<T>(sum);
+        }
+        const auto& below = levels_[level - 1];
+        if (2 * index + 1 >= below.size()) return ascend(level - 1, 2 * index, weights);
+        return ascend(level - 1, 2 * index, weights) * below[2 * index + 1] +
+               ascend(level - 1, 2 * index + 1, weights) * below[2 * index];
+    }
+};
@@ -0,0 +1,222 @@
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+thread_local const TaskScheduler* t_scheduler = nullptr;
+thread_local unsigned t_index = 0;
+
+void raiseMax(std::atomic<std::size_t>& target, std::size_t value) {
+    std::size_t seen = target.load(std::memory_order_relaxed);
+    while (value > seen && !target.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+}
+}
+
+TaskScheduler::TaskScheduler(unsigned workers) {
+    if (workers == 0) workers = std::max(1u, std::thread::hardware_concurrency());
+    workers_.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i) workers_.push_back(std::make_unique<Worker>());
+
+    threads_.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i) threads_.emplace_back([this, i] { workerLoop(i); });
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+TaskScheduler& TaskScheduler::shared() {
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+unsigned TaskScheduler::currentIndex() const {
+    return t_scheduler == this ? t_index : workerCount();
+}
+
+void TaskScheduler::submit(Task task) {
+    unsigned index = currentIndex();
+    if (index == workerCount()) {
+        index = nextQueue_.fetch_add(1, std::memory_order_relaxed) % workerCount();
+    }
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    push(index, std::move(task));
+
+    // Taking the lock orders this push before any sleeper's predicate check.
+    { std::lock_guard<std::mutex> lock(sleepMutex_); }
+    wake_.notify_one();
+}
+
+void TaskScheduler::push(unsigned index, Task task) {
+    Worker& worker = *workers_[index];
+    std::size_t depth;
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+        depth = worker.tasks.size();
+        // Counted while the task is only visible under this lock, so the
+        // decrement of whoever pops or steals it can never run first and
+        // wrap the count.
+        queued_.fetch_add(1, std::memory_order_release);
+    }
+    raiseMax(worker.maxDepth, depth);
+}
+
+bool TaskScheduler::popLocal(unsigned index, Task& task) {
+    Worker& worker = *workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) return false;
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool TaskScheduler::steal(unsigned start, Task& task) {
+    const unsigned n = workerCount();
+    for (unsigned k = 1; k <= n; ++k) {
+        Worker& victim = *workers_[(start + k) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.tasks.empty()) continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+bool TaskScheduler::runPending() {
+    unsigned index = currentIndex();
+    Task task;
+    if (index < workerCount()) {
+        if (!popLocal(index, task)) {
+            if (!steal(index, task)) return false;
+            workers_[index]->steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        task();
+        workers_[index]->executed.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (!steal(nextQueue_.load(std::memory_order_relaxed), task)) return false;
+    externalSteals_.fetch_add(1, std::memory_order_relaxed);
+    task();
+    externalExecuted_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void TaskScheduler::workerLoop(unsigned index) {
+    t_scheduler = this;
+    t_index = index;
+    Worker& self = *workers_[index];
+
+    for (;;) {
+        Task task;
+        if (popLocal(index, task)) {
+            task();
+            self.executed.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        if (steal(index, task)) {
+            self.steals.fetch_add(1, std::memory_order_relaxed);
+            task();
+            self.executed.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        self.failedSteals.fetch_add(1, std::memory_order_relaxed);
+
+        auto idleStart = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            wake_.wait(lock, [&] { return stopping_ || queued_.load(std::memory_order_acquire) > 0; });
+            if (stopping_ && queued_.load(std::memory_order_acquire) == 0) return;
+        }
+        auto idle = std::chrono::steady_clock::now() - idleStart;
+        self.idleNanos.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(idle).count(),
+                                 std::memory_order_relaxed);
+    }
+}
+
+TaskScheduler::Counters TaskScheduler::counters() const {
+    Counters c;
+    c.submitted = submitted_.load(std::memory_order_relaxed);
+    c.executed = externalExecuted_.load(std::memory_order_relaxed);
+    c.steals = externalSteals_.load(std::memory_order_relaxed);
+    std::int64_t idle = 0;
+    for (const auto& worker : workers_) {
+        c.executed += worker->executed.load(std::memory_order_relaxed);
+        c.steals += worker->steals.load(std::memory_order_relaxed);
+        c.failedSteals += worker->failedSteals.load(std::memory_order_relaxed);
+        idle += worker->idleNanos.load(std::memory_order_relaxed);
+        c.maxQueueDepth = std::max(c.maxQueueDepth, worker->maxDepth.load(std::memory_order_relaxed));
+    }
+    c.idle = std::chrono::nanoseconds(idle);
+    c.queueDepth = queued_.load(std::memory_order_relaxed);
+    return c;
+}
+
+void TaskScheduler::resetCounters() {
+    submitted_.store(0, std::memory_order_relaxed);
+    externalExecuted_.store(0, std::memory_order_relaxed);
+    externalSteals_.store(0, std::memory_order_relaxed);
+    for (auto& worker : workers_) {
+        worker->executed.store(0, std::memory_order_relaxed);
+        worker->steals.store(0, std::memory_order_relaxed);
+        worker->failedSteals.store(0, std::memory_order_relaxed);
+        worker->idleNanos.store(0, std::memory_order_relaxed);
+        worker->maxDepth.store(0, std::memory_order_relaxed);
+    }
+}
+
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    } catch (...) {
+        // Destruction only has to outlive the tasks; wait() is where errors surface.
+    }
+}
+
+void TaskGroup::run(TaskScheduler::Task task) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    scheduler_.submit([this, task = std::move(task)] {
+        if (!isCancelled()) {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!failure_) failure_ = std::current_exception();
+                cancel();
+            }
+        }
+        finish();
+    });
+}
+
+void TaskGroup::finish() {
+    // Decrement under the lock so wait() cannot return, and the group cannot
+    // be destroyed, while this thread still touches it.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) done_.notify_all();
+}
+
+void TaskGroup::wait() {
+    while (pending_.load(std::memory_order_acquire) > 0) {
+        if (scheduler_.runPending()) continue;
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait_for(lock, std::chrono::milliseconds(1),
+                       [&] { return pending_.load(std::memory_order_acquire) == 0; });
+    }
+
+    std::exception_ptr failure;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        failure = std::exchange(failure_, nullptr);
+    }
+    if (failure) std::rethrow_exception(failure);
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed pool of workers, each with its own deque. A worker pushes and pops
+// at the back of its deque (LIFO, cache-warm) and steals from the front of
+// the others when it runs dry. Tasks submitted from outside the pool are
+// dealt round-robin. Raw tasks must not throw; TaskGroup catches for them.
+class TaskScheduler {
+public:
+    using Task = std::function<void()>;
+
+    struct Counters {
+        std::uint64_t submitted = 0;
+        std::uint64_t executed = 0;
+        std::uint64_t steals = 0;
+        std::uint64_t failedSteals = 0;   // sweeps over every victim that found nothing
+        std::chrono::nanoseconds idle{0}; // summed over workers
+        std::size_t queueDepth = 0;       // tasks waiting right now
+        std::size_t maxQueueDepth = 0;    // deepest single deque seen
+    };
+
+    explicit TaskScheduler(unsigned workers = 0);  // 0 = all cores
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    void submit(Task task);
+
+    // Runs one queued task on the calling thread, if there is one. Lets a
+    // thread that is waiting on tasks help instead of blocking.
+    bool runPending();
+
+    unsigned workerCount() const { return static_cast<unsigned>(workers_.size()); }
+
+    Counters counters() const;
+    void resetCounters();
+
+    // Process-wide pool sized to the machine, started on first use.
+    static TaskScheduler& shared();
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::atomic<std::uint64_t> executed{0};
+        std::atomic<std::uint64_t> steals{0};
+        std::atomic<std::uint64_t> failedSteals{0};
+        std::atomic<std::int64_t> idleNanos{0};
+        std::atomic<std::size_t> maxDepth{0};
+    };
+
+    void push(unsigned index, Task task);
+    bool popLocal(unsigned index, Task& task);
+    bool steal(unsigned start, Task& task);
+    void workerLoop(unsigned index);
+
+    // Index of the calling thread in this pool, or workerCount() outside it.
+    unsigned currentIndex() const;
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<unsigned> nextQueue_{0};
+    std::atomic<std::uint64_t> submitted_{0};
+    std::atomic<std::uint64_t> externalExecuted_{0};
+    std::atomic<std::uint64_t> externalSteals_{0};
+
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+// Tasks that finish together. wait() helps run queued work until every task
+// in the group is done, then rethrows the first exception any of them threw.
+// Cancellation is cooperative: tasks not yet started are skipped, running
+// ones can poll isCancelled().
+class TaskGroup {
+public:
+    explicit TaskGroup(TaskScheduler& scheduler = TaskScheduler::shared()) : scheduler_(scheduler) {}
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    void run(TaskScheduler::Task task);
+    void wait();
+
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool isCancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+    TaskScheduler& scheduler() { return scheduler_; }
+
+private:
+    void finish();
+
+    TaskScheduler& scheduler_;
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<bool> cancelled_{false};
+    std::mutex mutex_;
+    std::condition_variable done_;
+    std::exception_ptr failure_;
+};
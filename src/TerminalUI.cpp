@@ -1,13 +1,22 @@
 #include "TerminalUI.h"
+#include "ClosedFormSolver.h"
+#include "SparsePolynomial.h"
 #include <limits>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <map>
+#include <mutex>
 #include <iomanip>
 
 #ifdef _WIN32
 #include <windows.h>
+#include <conio.h>
 #else
 #include <stdlib.h>
+#include <poll.h>
+#include <unistd.h>
 #endif
 
 TerminalUI::TerminalUI(DbManager& db) : db_(db) {}
@@ -242,15 +251,22 @@ void TerminalUI::solveCustomPolynomial() {
     std::cout << "You can solve any polynomial equation of any degree!\n\n";
     std::cout << "Enter polynomial coefficients separated by commas (highest degree first).\n";
     std::cout << "Example: For x² - 3x + 2, enter: 1,-3,2\n";
-    std::cout << "Example: For x³ - 2x + 1, enter: 1,0,-2,1\n\n";
+    std::cout << "Example: For x³ - 2x + 1, enter: 1,0,-2,1\n";
+    std::cout << "Sparse terms are coefficient@exponent: for x^10000 - 1, enter: 1@10000,-1\n\n";
     
     std::string coefficients = getInput("Enter coefficients: ");
     
     try {
-        auto poly = Polynomial<double>::parse(coefficients);
+        auto sparse = SparsePolynomial<double>::parse(coefficients);
+        if (sparse.degree() > Polynomial<double>::kMaxParsedDegree) {
+            printError("Degree " + std::to_string(sparse.degree()) + " is too large to solve.");
+            waitForEnter();
+            return;
+        }
+        auto poly = sparse.toDense();
         
-        std::cout << "\n🧮 Polynomial: " << poly.toString() << "\n";
-        std::cout << "📐 Degree: " << poly.degree() << "\n\n";
+        std::cout << "\n🧮 Polynomial: " << sparse.toString() << "\n";
+        std::cout << "📐 Degree: " << poly.degree() << " (" << sparse.size() << " terms)\n\n";
         
         // Get solving parameters
         double tolerance = getDoubleInput("Enter tolerance (default 0.000001): ");
@@ -259,9 +275,88 @@ void TerminalUI::solveCustomPolynomial() {
         int maxIterations = getIntInput("Enter maximum iterations (default 1000): ");
         if (maxIterations <= 0) maxIterations = 1000;
         
-        std::cout << "\n🔍 Solving polynomial using Newton-Raphson method...\n";
+        double timeLimit = getDoubleInput("Enter time limit in seconds (default 30): ");
+        if (timeLimit <= 0) timeLimit = 30;
+        
+        if (poly.degree() <= ClosedFormSolver<double>::kMaxDegree) {
+            std::cout << "\n🔍 Solving polynomial in closed form...\n";
+        } else {
+            std::cout << "\n🔍 Solving polynomial using the Aberth-Ehrlich method... (press Enter to abort)\n";
+        }
+        
+        // The solve runs on its own thread; this one draws progress and
+        // watches the keyboard until it finishes, times out or is aborted.
+        std::atomic<bool> cancelled{false};
+        std::atomic<size_t> settled{0};
+        SolveBudget budget = SolveBudget::within(
+            std::chrono::duration_cast<SolveBudget::Clock::duration>(std::chrono::duration<double>(timeLimit)));
+        budget.cancelled = &cancelled;
+        budget.progress = &settled;
+        
+        // Roots stream in from the solver thread and are printed here as they
+        // arrive, so the first one shows up long before the solve ends.
+        std::mutex streamMutex;
+        std::vector<std::pair<std::complex<double>, double>> streamed;
+        auto sink = [&](const std::complex<double>& z, double residual) {
+            std::lock_guard<std::mutex> lock(streamMutex);
+            streamed.emplace_back(z, residual);
+        };
+        size_t printed = 0;
+        auto printStreamed = [&] {
+            std::lock_guard<std::mutex> lock(streamMutex);
+            for (; printed < streamed.size(); ++printed) {
+                const auto& [z, residual] = streamed[printed];
+                std::cout << "\r   root " << std::setw(5) << printed + 1 << ": " << std::fixed << std::setprecision(6)
+                          << z.real();
+                if (!PolynomialSolver<double>::isRealRoot(z)) {
+                    std::cout << (z.imag() < 0 ? " - " : " + ") << std::abs(z.imag()) << "i";
+                }
+                std::cout << "   (residual " << std::scientific << std::setprecision(2) << residual << ")\n";
+            }
+        };
+        
+        auto started = std::chrono::steady_clock::now();
+        auto pending = std::async(std::launch::async, [&] {
+            return PolynomialSolver<double>::solveWithMultiplicity(poly, budget, SolverEngine::Auto,
+                                                                 tolerance, maxIterations, sink);
+        });
+        bool showedProgress = false;
+        while (pending.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready) {
+            printStreamed();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started;
+            std::cout << "\r   " << settled.load() << " / " << poly.degree() << " roots settled, "
+                      << std::fixed << std::setprecision(1) << elapsed.count() << " s   " << std::flush;
+            showedProgress = true;
+            if (!cancelled.load() && abortRequested()) {
+                cancelled.store(true);
+                std::cout << "\n   Aborting...";
+            }
+        }
+        if (showedProgress) {
+            printStreamed();
+            std::cout << "\n";
+        }
+        
+        SolveResult<double> result = pending.get();
+        std::span<const std::complex<double>> allRoots(result.roots.data(), result.converged);
         
-        auto roots = PolynomialSolver<double>::solveNewton(poly, tolerance, maxIterations);
+        // Real roots ascending, each with the multiplicity of its factor.
+        std::vector<std::pair<double, int>> roots;
+        for (size_t i = 0; i < allRoots.size(); ++i) {
+            if (PolynomialSolver<double>::isRealRoot(allRoots[i]))
+                roots.emplace_back(allRoots[i].real(), result.multiplicity(i));
+        }
+        std::sort(roots.begin(), roots.end());
+        auto withMultiplicity = [](std::ostream& os, double root, int multiplicity) {
+            os << root;
+            if (multiplicity > 1) os << " (×" << multiplicity << ")";
+        };
+        
+        if (!result.complete()) {
+            std::cout << "\n⚠ Solve stopped early (" << solveStatusName(result.status) << "): "
+                      << result.converged << " of " << result.roots.size()
+                      << " roots converged after " << result.iterations << " iterations.\n";
+        }
         
         std::cout << "\n✅ Solution Results:\n";
         std::cout << std::string(40, '-') << "\n";
@@ -272,14 +367,15 @@ void TerminalUI::solveCustomPolynomial() {
             std::cout << "Real Roots Found: ";
             for (size_t i = 0; i < roots.size(); ++i) {
                 if (i > 0) std::cout << ", ";
-                std::cout << std::fixed << std::setprecision(6) << roots[i];
+                std::cout << std::fixed << std::setprecision(6);
+                withMultiplicity(std::cout, roots[i].first, roots[i].second);
             }
             std::cout << "\n";
             
             // Verify roots
             std::cout << "\n🔍 Verification:\n";
-            for (double root : roots) {
-                double verification = poly.evaluate(root);
+            for (const auto& [root, multiplicity] : roots) {
+                double verification = poly.evaluate(root, EvaluationMode::Compensated);
                 std::cout << "  p(" << std::setprecision(6) << root << ") = " 
                          << std::scientific << verification;
                 if (std::fabs(verification) < tolerance * 10) {
@@ -290,6 +386,19 @@ void TerminalUI::solveCustomPolynomial() {
             }
         }
         
+        if (allRoots.size() > roots.size()) {
+            std::cout << "\nComplex Roots:\n";
+            for (size_t i = 0; i < allRoots.size(); ++i) {
+                const auto& z = allRoots[i];
+                if (z.imag() > 0 && !PolynomialSolver<double>::isRealRoot(z)) {
+                    std::cout << "  " << std::fixed << std::setprecision(6) << z.real()
+                              << " ± " << z.imag() << "i";
+                    if (result.multiplicity(i) > 1) std::cout << " (×" << result.multiplicity(i) << ")";
+                    std::cout << "\n";
+                }
+            }
+        }
+        
         // Save to custom solutions
         CustomSolutionRequest request;
         request.userId = currentUser_.id;
@@ -299,13 +408,16 @@ void TerminalUI::solveCustomPolynomial() {
         oss << "Roots: ";
         for (size_t i = 0; i < roots.size(); ++i) {
             if (i > 0) oss << ", ";
-            oss << roots[i];
+            withMultiplicity(oss, roots[i].first, roots[i].second);
         }
         request.solution = oss.str();
         
-        db_.insertCustomSolutionRequest(request);
-        
-        std::cout << "\n💾 Solution saved to your history.\n";
+        if (result.complete()) {
+            db_.insertCustomSolutionRequest(request);
+            std::cout << "\n💾 Solution saved to your history.\n";
+        } else {
+            std::cout << "\nPartial solution not saved.\n";
+        }
         
     } catch (const std::exception& e) {
         printError("Error solving polynomial: " + std::string(e.what()));
@@ -530,6 +642,21 @@ void TerminalUI::waitForEnter() {
     std::cin.ignore();
 }
 
+bool TerminalUI::abortRequested() {
+#ifdef _WIN32
+    if (!_kbhit()) return false;
+    _getch();
+    return true;
+#else
+    // Canonical-mode stdin only turns readable once Enter is pressed.
+    pollfd input{ STDIN_FILENO, POLLIN, 0 };
+    if (poll(&input, 1, 0) <= 0) return false;
+    std::string discard;
+    std::getline(std::cin, discard);
+    return true;
+#endif
+}
+
 double TerminalUI::getDoubleInput(const std::string& prompt) {
     std::cout << prompt;
     double value;
@@ -537,8 +664,3 @@ double TerminalUI::getDoubleInput(const std::string& prompt) {
     std::cin.ignore();
     return value;
 }
-
-void TerminalUI::waitForEnter() {
-    std::cout << "\nPress Enter to continue...";
-    std::cin.ignore();
-}
\ No newline at end of file
@@ -45,4 +45,7 @@ private:
     double getDoubleInput(const std::string& prompt);
     void waitForEnter();
     
+    // Non-blocking: true once the user has pressed a key (Enter outside Windows).
+    bool abortRequested();
+    
 };
\ No newline at end of file